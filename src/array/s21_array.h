@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <initializer_list>
 
 #ifdef DEBUG
@@ -10,10 +11,18 @@
 #endif
 
 #include <iterator>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
 
+// A fixed-size array. Everything is constexpr, so it can hold lookup
+// tables computed at compile time, and for a trivial value_type it is
+// trivially copyable. operator[] is unchecked like in std::array (at()
+// checks the position), and the loops of fill, swap and the
+// comparisons are plain loops over N_ elements the compiler vectorizes.
 template <typename Tp_, std::size_t N_>
 class array {
  public:
@@ -25,75 +34,86 @@ class array {
   typedef value_type *iterator;
   typedef const value_type *const_iterator;
 
-  // default constructor, creates an empty array
+  // default constructor, creates a value-initialized array
   array() = default;
 
   // initializer list constructor, creates array initizialized using
-  array(const std::initializer_list<value_type> &items);
+  // the items; the rest of the elements are value-initialized
+  constexpr array(const std::initializer_list<value_type> &items);
 
-  // copy constructor
-  array(const array &other) { std::copy(other.data_, other.data_ + N_, data_); }
-
-  // move constructor
-  array(array &&a) { std::move(a.data_, a.data_ + N_, data_); }
-
-  // assignment operator overload for copying an object
-  array &operator=(const array &other);
-
-  // assignment operator overload for moving an object
-  array &operator=(array &&a);
+  // copy and move constructors and assignments are the ones of the
+  // elements, trivial for a trivial value_type
+  array(const array &other) = default;
+  array(array &&a) = default;
+  array &operator=(const array &other) = default;
+  array &operator=(array &&a) = default;
 
   // destructor
   ~array() = default;  // nothing to do
 
   // access a specified element with bounds checking
-  reference at(size_type pos) {
+  constexpr reference at(size_type pos) {
+    if (pos >= N_) throw std::out_of_range("array::at: pos >= N_");
+    return data_[pos];
+  }
+  constexpr const_reference at(size_type pos) const {
     if (pos >= N_) throw std::out_of_range("array::at: pos >= N_");
     return data_[pos];
   }
 
-  // access a specified element
-  reference operator[](size_type pos) {
-    if (pos >= N_)
-      throw std::out_of_range(
-          "array::at: pos >= N_");  // std::array does not throw
+  // access a specified element without bounds checking
+  constexpr reference operator[](size_type pos) noexcept {
+    return data_[pos];
+  }
+  constexpr const_reference operator[](size_type pos) const noexcept {
     return data_[pos];
   }
 
   // access the first element
-  const_reference front() { return data_[0]; }
+  constexpr reference front() noexcept { return data_[0]; }
+  constexpr const_reference front() const noexcept { return data_[0]; }
 
   // access the last element
-  const_reference back() { return (N_) ? data_[N_ - 1] : data_(0); }
+  constexpr reference back() noexcept { return data_[N_ ? N_ - 1 : 0]; }
+  constexpr const_reference back() const noexcept {
+    return data_[N_ ? N_ - 1 : 0];
+  }
 
   // direct access to the underlying array
-  iterator data() { return iterator(data_); }
+  constexpr iterator data() noexcept { return data_; }
+  constexpr const_iterator data() const noexcept { return data_; }
 
   // returns an iterator to the beginning
-  iterator begin(void) { return iterator(data_); }
+  constexpr iterator begin() noexcept { return data_; }
+  constexpr const_iterator begin() const noexcept { return data_; }
+  constexpr const_iterator cbegin() const noexcept { return data_; }
 
   // returns an iterator to the end
-  iterator end() { return iterator(data_ + N_); }  // out of bounds
+  constexpr iterator end() noexcept { return data_ + N_; }
+  constexpr const_iterator end() const noexcept { return data_ + N_; }
+  constexpr const_iterator cend() const noexcept { return data_ + N_; }
 
   // checks whether the container is empty
-  bool empty() noexcept { return (size() == 0) ? true : false; };
+  constexpr bool empty() const noexcept { return N_ == 0; }
 
   // returns the number of elements
-  size_type size() { return N_; }
+  constexpr size_type size() const noexcept { return N_; }
 
   // returns the maximum possible number of elements
-  size_type max_size() { return N_; }
+  constexpr size_type max_size() const noexcept { return N_; }
 
   // swaps the contents
-  void swap(array &other) { std::swap_ranges(begin(), end(), other.begin()); }
+  constexpr void swap(array &other) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value &&
+      std::is_nothrow_move_assignable<value_type>::value);
 
   // assigns the given value to all elements in the container.
-  void fill(const_reference value) {
+  constexpr void fill(const_reference value) {
     for (size_type i = 0; i < N_; i++) data_[i] = value;
   }
 
 #ifdef DEBUG
-  void print() {
+  void print() const {
     for (size_type i = 0; i < N_; i++)
       if (i == N_ - 1)
         std::cout << data_[i] << "\n";
@@ -103,35 +123,70 @@ class array {
 #endif  // DEBUG
 
  private:
-  Tp_ data_[(N_) ? N_ : 1];  // NOLINT
+  Tp_ data_[(N_) ? N_ : 1]{};  // NOLINT
 };
 
 template <typename Tp_, size_t N_>
-array<Tp_, N_>::array(std::initializer_list<Tp_> const &items) : data_() {
+constexpr array<Tp_, N_>::array(std::initializer_list<Tp_> const &items) {
   if (items.size() > N_) {
     throw std::out_of_range("array::initilized_constructor out of range");
   }
 
-  int i = 0;
-  for (value_type item : items) {
+  size_type i = 0;
+  for (const value_type &item : items) {
     data_[i++] = item;
   }
 }
 
+// std::swap isn't constexpr before C++20
 template <typename Tp_, size_t N_>
-array<Tp_, N_> &array<Tp_, N_>::operator=(const array &other) {
-  if (this != &other) {
-    std::copy(other.data_, other.data_ + N_, data_);
+constexpr void array<Tp_, N_>::swap(array &other) noexcept(
+    std::is_nothrow_move_constructible<value_type>::value &&
+    std::is_nothrow_move_assignable<value_type>::value) {
+  for (size_type i = 0; i < N_; i++) {
+    value_type tmp(std::move(data_[i]));
+    data_[i] = std::move(other.data_[i]);
+    other.data_[i] = std::move(tmp);
   }
+}
+
+// comparisons, element by element
+template <typename Tp_, size_t N_>
+constexpr bool operator==(const array<Tp_, N_> &a, const array<Tp_, N_> &b) {
+  for (size_t i = 0; i < N_; i++)
+    if (!(a[i] == b[i])) return false;
+  return true;
+}
 
-  return *this;
+template <typename Tp_, size_t N_>
+constexpr bool operator!=(const array<Tp_, N_> &a, const array<Tp_, N_> &b) {
+  return !(a == b);
 }
+
+// lexicographical, like std::lexicographical_compare (which isn't
+// constexpr before C++20)
 template <typename Tp_, size_t N_>
-array<Tp_, N_> &array<Tp_, N_>::operator=(array &&a) {
-  if (this != &a) {
-    std::move(a.data_, a.data_ + N_, data_);
+constexpr bool operator<(const array<Tp_, N_> &a, const array<Tp_, N_> &b) {
+  for (size_t i = 0; i < N_; i++) {
+    if (a[i] < b[i]) return true;
+    if (b[i] < a[i]) return false;
   }
-  return *this;
+  return false;
+}
+
+template <typename Tp_, size_t N_>
+constexpr bool operator>(const array<Tp_, N_> &a, const array<Tp_, N_> &b) {
+  return b < a;
+}
+
+template <typename Tp_, size_t N_>
+constexpr bool operator<=(const array<Tp_, N_> &a, const array<Tp_, N_> &b) {
+  return !(b < a);
+}
+
+template <typename Tp_, size_t N_>
+constexpr bool operator>=(const array<Tp_, N_> &a, const array<Tp_, N_> &b) {
+  return !(a < b);
 }
 
 }  // namespace s21
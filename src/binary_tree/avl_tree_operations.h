@@ -5,16 +5,40 @@
 #ifndef S21_CONTAINERS_AVL_TREE_OPERATIONS_H_  // NOLINT
 #define S21_CONTAINERS_AVL_TREE_OPERATIONS_H_  // NOLINT
 
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "interval.h"
+
 #ifdef DEBUG
 #include <iostream>
 #endif  // DEBUG
 
 namespace s21 {
 
+// The summary of the subtree (see NodeSummary) is kept up to date by
+// FixHeight, like the height.
 template <typename T>
-struct Node {
+struct Node : NodeSummary<T> {
   explicit Node(const T& data) noexcept
-      : data_(data), left_(nullptr), right_(nullptr), height_(1) {}
+      : data_(data), left_(nullptr), right_(nullptr), height_(1) {
+    this->Reset(data_);
+  }
+
+  // Constructs the data in place from args
+  template <typename... Args>
+  explicit Node(std::in_place_t, Args&&... args)
+      : data_(std::forward<Args>(args)...),
+        left_(nullptr),
+        right_(nullptr),
+        height_(1) {
+    this->Reset(data_);
+  }
 
   T data_;
   Node* left_;
@@ -22,12 +46,32 @@ struct Node {
   unsigned char height_;
 };
 
-template <typename K, typename T>
+// The data, the two children and the height, each in a pointer-sized
+// slot: the empty summary of an ordinary tree takes no space.
+static_assert(sizeof(Node<int>) == 4 * sizeof(Node<int>*),
+              "NodeSummary must be an empty base of Node");
+
+// Compare orders the keys like std::less does for std::map.
+template <typename K, typename T, typename Compare = std::less<K>>
 class AvlTreeOperations {
-  typedef K (*FuncPtr)(const T& data);
+  typedef const K& (*FuncPtr)(const T& data);
 
  public:
-  explicit AvlTreeOperations(FuncPtr key_extractor);
+  // An AVL tree of height h has at least Fib(h + 2) - 1 nodes, so its
+  // height is below 1.44 * log2(n + 2) and can't exceed 91 for any
+  // size_t number of nodes. It bounds all the explicit path stacks.
+  static constexpr int kMaxHeight = 92;
+
+  // The search path to the place of a new node: the nodes from the
+  // root down and the side taken at each of them.
+  struct Position {
+    Node<T>* path[kMaxHeight];
+    bool is_left[kMaxHeight];
+    int depth = 0;
+  };
+
+  explicit AvlTreeOperations(FuncPtr key_extractor,
+                             const Compare& comp = Compare());
 
   inline unsigned char Height(Node<T>* p) const noexcept;
   inline int BFactor(Node<T>* p) const noexcept;
@@ -37,55 +81,118 @@ class AvlTreeOperations {
   Node<T>* RotateLeft(Node<T>* p) const;
   Node<T>* Balance(Node<T>* p) const;
   Node<T>* InsertNode(Node<T>* p, Node<T>* node) const;
-  Node<T>* Insert(Node<T>* p, T k) const;
+  template <typename KeyLike>
+  Node<T>* FindPosition(Node<T>* p, const KeyLike& key, Position* pos) const;
+  bool FindEdgePosition(Node<T>* p, Node<T>* hint, const K& key,
+                        Position* pos) const;
+  Node<T>* InsertAt(Position* pos, Node<T>* node) const;
+  Node<T>* Insert(Node<T>* p, const T& data) const;
   Node<T>* FindMin(Node<T>* p) const;
   Node<T>* FindMax(Node<T>* p) const;
-  Node<T>* Find(Node<T>* p, K key) const;
+  template <typename KeyLike>
+  Node<T>* Find(Node<T>* p, const KeyLike& key) const;
+  template <typename KeyLike>
+  Node<T>* LowerBound(Node<T>* p, const KeyLike& key) const;
+  template <typename KeyLike>
+  Node<T>* UpperBound(Node<T>* p, const KeyLike& key) const;
   Node<T>* RemoveMin(Node<T>* p) const;
   Node<T>* ExtractNode(Node<T>* root, Node<T>* node) const;
   Node<T>* Remove(Node<T>* p, Node<T>* node) const;
   Node<T>* Copy(Node<T>* p) const;
   Node<T>* Clear(Node<T>* p) const;
+  template <typename Visit>
+  Node<T>* Clear(Node<T>* p, Visit visit) const;
+  Node<T>* CopyParallel(Node<T>* p, unsigned n_threads) const;
+  Node<T>* ClearParallel(Node<T>* p, unsigned n_threads) const;
+  template <typename KeyLike>
+  void Split(Node<T>* p, const KeyLike& key, bool key_left, Node<T>** left,
+             Node<T>** right) const;
+  Node<T>* Join(Node<T>* left, Node<T>* mid, Node<T>* right) const;
+  Node<T>* Join(Node<T>* left, Node<T>* right) const;
+  Node<T>* Build(Node<T>** nodes, size_t n) const;
+  template <typename A, typename B>
+  bool Less(const A& a, const B& b) const {
+    return comp_(a, b);
+  }
+  template <typename Pred, typename Visit>
+  void RemoveIf(Node<T>** root, Pred pred, Visit visit) const;
   Node<T>* Next(Node<T>* root, Node<T>* p) const;
   Node<T>* Prev(Node<T>* root, Node<T>* p) const;
+  // Interval trees only: calls visit(node) in key order for every node
+  // whose interval has a point in common with [lo, hi]
+  template <typename E, typename Visit>
+  void Overlapping(Node<T>* p, const E& lo, const E& hi, Visit visit) const;
 
   void Print(Node<T>* p, int level = 0) const;
 
  private:
+  // Hangs sub under the last node of the path (on the side given by
+  // is_left) and rebalances the path bottom-up. Stops as soon as a node
+  // keeps its height and its place, because nothing above it changes.
+  // Returns the new root.
+  Node<T>* FixPath(Node<T>** path, bool* is_left, int depth,
+                   Node<T>* sub) const;
+
+  // Subtrees lower than this (about 2^16 nodes at most) are never split
+  // between threads: the work is too small to pay for a thread.
+  static constexpr unsigned char kParallelMinHeight = 16;
+
+  // Splits the top of the tree into subtrees for CopyParallel and
+  // ClearParallel. depth limits how many levels are split.
+  void SplitCopy(Node<T>* p, Node<T>** slot, int depth,
+                 std::vector<Node<T>*>* src,
+                 std::vector<Node<T>**>* dst) const;
+  void SplitClear(Node<T>* p, int depth, std::vector<Node<T>*>* tasks) const;
+  static int SplitDepth(unsigned n_threads) noexcept;
+
+  // Runs task(i) for every i < n_tasks on up to n_threads threads.
+  template <typename Task>
+  static void RunParallel(size_t n_tasks, unsigned n_threads, Task task);
+
   // Function to extract the key from the node data.
   // The key is used to arrange the nodes of the tree.
   // By default the data are itself the key, but we can
   // change it using differnt ExtractKey functions.
-  FuncPtr ExtractKey{[](const T& data) -> K { return data; }};
+  FuncPtr ExtractKey{[](const T& data) -> const K& { return data; }};
+
+  // Strict weak ordering of the keys. Lookups take any KeyLike type
+  // it can compare with K, so a transparent Compare avoids building
+  // a temporary key.
+  Compare comp_;
 };
 
 // Constructor takes key_extractor function as an argument
 // and stores it as 'ExtractKey' function.
-template <typename K, typename T>
-AvlTreeOperations<K, T>::AvlTreeOperations(FuncPtr key_extractor)
-    : ExtractKey(key_extractor) {}
+template <typename K, typename T, typename Compare>
+AvlTreeOperations<K, T, Compare>::AvlTreeOperations(FuncPtr key_extractor,
+                                                    const Compare& comp)
+    : ExtractKey(key_extractor), comp_(comp) {}
 
-template <typename K, typename T>
-inline unsigned char AvlTreeOperations<K, T>::Height(
+template <typename K, typename T, typename Compare>
+inline unsigned char AvlTreeOperations<K, T, Compare>::Height(
     Node<T>* p) const noexcept {
   return p ? p->height_ : 0;
 }
 
-template <typename K, typename T>
-inline int AvlTreeOperations<K, T>::BFactor(Node<T>* p) const noexcept {
+template <typename K, typename T, typename Compare>
+inline int AvlTreeOperations<K, T, Compare>::BFactor(
+    Node<T>* p) const noexcept {
   return Height(p->right_) - Height(p->left_);
 }
 
 inline int Max(int a, int b) noexcept { return a > b ? a : b; }
 
-template <typename K, typename T>
-inline void AvlTreeOperations<K, T>::FixHeight(Node<T>* p) const noexcept {
+template <typename K, typename T, typename Compare>
+inline void AvlTreeOperations<K, T, Compare>::FixHeight(
+    Node<T>* p) const noexcept {
   p->height_ = Max(Height(p->left_), Height(p->right_)) + 1;
+  p->Update(p->data_, p->left_, p->right_);
 }
 
 // Return a pointer to the next node (ascending order)
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::Next(Node<T>* root, Node<T>* p) const {
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::Next(Node<T>* root,
+                                                Node<T>* p) const {
   if (p == nullptr) {
     return nullptr;
   } else if (p->right_) {
@@ -96,7 +203,7 @@ Node<T>* AvlTreeOperations<K, T>::Next(Node<T>* root, Node<T>* p) const {
     Node<T>* w = nullptr;
     Node<T>* q = root;
     while (q != p) {
-      if (ExtractKey(p->data_) < ExtractKey(q->data_)) {
+      if (comp_(ExtractKey(p->data_), ExtractKey(q->data_))) {
         w = q;
         q = q->left_;
       } else {
@@ -109,8 +216,9 @@ Node<T>* AvlTreeOperations<K, T>::Next(Node<T>* root, Node<T>* p) const {
 }
 
 // Return a pointer to the previous node
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::Prev(Node<T>* root, Node<T>* p) const {
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::Prev(Node<T>* root,
+                                                Node<T>* p) const {
   if (!p) {
     // It's the end() iterator! We are to find the last
     // node (with the greatest value)
@@ -123,7 +231,7 @@ Node<T>* AvlTreeOperations<K, T>::Prev(Node<T>* root, Node<T>* p) const {
     Node<T>* w = nullptr;
     Node<T>* q = root;
     while (q != p) {
-      if (ExtractKey(p->data_) < ExtractKey(q->data_)) {
+      if (comp_(ExtractKey(p->data_), ExtractKey(q->data_))) {
         q = q->left_;
       } else {
         w = q;
@@ -135,8 +243,27 @@ Node<T>* AvlTreeOperations<K, T>::Prev(Node<T>* root, Node<T>* p) const {
   return p;
 }
 
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::RotateRight(Node<T>* p) const {
+// Skips the subtrees whose intervals all end before lo and the right
+// subtrees of the nodes that start after hi. Every node visited either
+// is in the answer or is on the way to one, so a query costs
+// O(log n) when nothing overlaps and O((k + 1) log n) at worst for k
+// answers, nearer to log n + k when they are close in key order.
+template <typename K, typename T, typename Compare>
+template <typename E, typename Visit>
+void AvlTreeOperations<K, T, Compare>::Overlapping(Node<T>* p, const E& lo,
+                                                   const E& hi,
+                                                   Visit visit) const {
+  while (p && !(p->max_hi_ < lo)) {
+    Overlapping(p->left_, lo, hi, visit);
+    const auto& range = IntervalTraits<T>::Get(p->data_);
+    if (hi < range.lo) return;
+    if (!(range.hi < lo)) visit(p);
+    p = p->right_;
+  }
+}
+
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::RotateRight(Node<T>* p) const {
   Node<T>* q = p->left_;
   p->left_ = q->right_;
   q->right_ = p;
@@ -145,8 +272,8 @@ Node<T>* AvlTreeOperations<K, T>::RotateRight(Node<T>* p) const {
   return q;
 }
 
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::RotateLeft(Node<T>* p) const {
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::RotateLeft(Node<T>* p) const {
   Node<T>* q = p->right_;
   p->right_ = q->left_;
   q->left_ = p;
@@ -156,8 +283,8 @@ Node<T>* AvlTreeOperations<K, T>::RotateLeft(Node<T>* p) const {
 }
 
 // Balances tree.
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::Balance(Node<T>* p) const {
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::Balance(Node<T>* p) const {
   FixHeight(p);
   if (BFactor(p) == 2) {
     if (BFactor(p->right_) < 0) p->right_ = RotateRight(p->right_);
@@ -170,116 +297,514 @@ Node<T>* AvlTreeOperations<K, T>::Balance(Node<T>* p) const {
   return p;
 }
 
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::FixPath(Node<T>** path,
+                                                   bool* is_left, int depth,
+                                                   Node<T>* sub) const {
+  for (int i = depth - 1; i >= 0; --i) {
+    Node<T>* q = path[i];
+    unsigned char height = q->height_;
+    NodeSummary<T> summary = *q;
+    if (is_left[i])
+      q->left_ = sub;
+    else
+      q->right_ = sub;
+    sub = Balance(q);
+    if (sub == q && q->height_ == height && summary == *q) return path[0];
+  }
+  return sub;
+}
+
 // Insert an existing node into the tree.
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::InsertNode(Node<T>* p, Node<T>* node) const {
-  if (!p) return node;
-  K key = ExtractKey(node->data_);
-  if (key < ExtractKey(p->data_))
-    p->left_ = InsertNode(p->left_, node);
-  else
-    p->right_ = InsertNode(p->right_, node);
-  return Balance(p);
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::InsertNode(Node<T>* p,
+                                                      Node<T>* node) const {
+  Node<T>* path[kMaxHeight];
+  bool is_left[kMaxHeight];
+  int depth = 0;
+  const K& key = ExtractKey(node->data_);
+  for (Node<T>* q = p; q;) {
+    path[depth] = q;
+    is_left[depth] = comp_(key, ExtractKey(q->data_));
+    q = is_left[depth++] ? q->left_ : q->right_;
+  }
+  return FixPath(path, is_left, depth, node);
 }
 
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::Insert(Node<T>* p, T data) const {
+// Descends to the key and returns the node with an equal key, if any.
+// Otherwise fills pos with the path to the place where the key goes.
+template <typename K, typename T, typename Compare>
+template <typename KeyLike>
+Node<T>* AvlTreeOperations<K, T, Compare>::FindPosition(Node<T>* p,
+                                                        const KeyLike& key,
+                                                        Position* pos) const {
+  pos->depth = 0;
+  while (p) {
+    const K& p_key = ExtractKey(p->data_);
+    bool less = comp_(key, p_key);
+    if (!less && !comp_(p_key, key)) return p;
+    pos->path[pos->depth] = p;
+    pos->is_left[pos->depth++] = less;
+    p = less ? p->left_ : p->right_;
+  }
+  return nullptr;
+}
+
+// The insertion hint fast path. If hint is nullptr (the end) and the
+// key is greater than the maximum, or hint is the minimum and the key
+// is less than it, fills pos with the spine leading there and returns
+// true. Walking the spine takes no key comparisons but the last one.
+template <typename K, typename T, typename Compare>
+bool AvlTreeOperations<K, T, Compare>::FindEdgePosition(Node<T>* p,
+                                                        Node<T>* hint,
+                                                        const K& key,
+                                                        Position* pos) const {
+  bool at_begin = hint != nullptr;
+  pos->depth = 0;
+  for (; p; p = at_begin ? p->left_ : p->right_) {
+    pos->path[pos->depth] = p;
+    pos->is_left[pos->depth++] = at_begin;
+  }
+  if (!pos->depth) return !at_begin;
+  const K& edge_key = ExtractKey(pos->path[pos->depth - 1]->data_);
+  if (at_begin)
+    return pos->path[pos->depth - 1] == hint && comp_(key, edge_key);
+  return comp_(edge_key, key);
+}
+
+// Hangs the node at the position found by FindPosition or
+// FindEdgePosition and returns the new root.
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::InsertAt(Position* pos,
+                                                    Node<T>* node) const {
+  return FixPath(pos->path, pos->is_left, pos->depth, node);
+}
+
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::Insert(Node<T>* p,
+                                                  const T& data) const {
   Node<T>* node = new Node<T>(data);
   return InsertNode(p, node);
 }
 
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::FindMin(Node<T>* p) const {
-  return p->left_ ? FindMin(p->left_) : p;
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::FindMin(Node<T>* p) const {
+  while (p->left_) p = p->left_;
+  return p;
 }
 
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::FindMax(Node<T>* p) const {
-  return p->right_ ? FindMax(p->right_) : p;
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::FindMax(Node<T>* p) const {
+  while (p->right_) p = p->right_;
+  return p;
 }
 
 // Returns the pointer to the node with the specified key
 // or nullptr if there is no such node.
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::Find(Node<T>* p, K key) const {
-  if (!p) return nullptr;
-  K root_key = ExtractKey(p->data_);
-  if (key < root_key)
-    return Find(p->left_, key);
-  else if (key > root_key)
-    return Find(p->right_, key);
+template <typename K, typename T, typename Compare>
+template <typename KeyLike>
+Node<T>* AvlTreeOperations<K, T, Compare>::Find(Node<T>* p,
+                                                const KeyLike& key) const {
+  while (p) {
+    const K& p_key = ExtractKey(p->data_);
+    if (comp_(key, p_key))
+      p = p->left_;
+    else if (comp_(p_key, key))
+      p = p->right_;
+    else
+      break;
+  }
   return p;
 }
 
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::RemoveMin(Node<T>* p) const {
-  if (p->left_ == 0) return p->right_;
-  p->left_ = RemoveMin(p->left_);
-  return Balance(p);
+// Returns the first node whose key is not less than the key
+// or nullptr if there is no such node.
+template <typename K, typename T, typename Compare>
+template <typename KeyLike>
+Node<T>* AvlTreeOperations<K, T, Compare>::LowerBound(
+    Node<T>* p, const KeyLike& key) const {
+  Node<T>* res = nullptr;
+  while (p) {
+    if (comp_(ExtractKey(p->data_), key)) {
+      p = p->right_;
+    } else {
+      res = p;
+      p = p->left_;
+    }
+  }
+  return res;
+}
+
+// Returns the first node whose key is greater than the key
+// or nullptr if there is no such node.
+template <typename K, typename T, typename Compare>
+template <typename KeyLike>
+Node<T>* AvlTreeOperations<K, T, Compare>::UpperBound(
+    Node<T>* p, const KeyLike& key) const {
+  Node<T>* res = nullptr;
+  while (p) {
+    if (comp_(key, ExtractKey(p->data_))) {
+      res = p;
+      p = p->left_;
+    } else {
+      p = p->right_;
+    }
+  }
+  return res;
+}
+
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::RemoveMin(Node<T>* p) const {
+  Node<T>* path[kMaxHeight];
+  bool is_left[kMaxHeight];
+  int depth = 0;
+  for (; p->left_; p = p->left_) {
+    path[depth] = p;
+    is_left[depth++] = true;
+  }
+  return FixPath(path, is_left, depth, p->right_);
 }
 
 // Just extracts the node from the tree (does not delete it's memory).
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::ExtractNode(Node<T>* p, Node<T>* node) const {
-  if (!p) return nullptr;
-  K p_key = ExtractKey(p->data_);
-  K node_key = ExtractKey(node->data_);
-  if (node_key < p_key) {
-    p->left_ = ExtractNode(p->left_, node);
-  } else if (node_key > p_key) {
-    p->right_ = ExtractNode(p->right_, node);
-  } else {
-    Node<T>* q = node->left_;
-    Node<T>* r = node->right_;
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::ExtractNode(Node<T>* p,
+                                                       Node<T>* node) const {
+  Node<T>* path[kMaxHeight];
+  bool is_left[kMaxHeight];
+  int depth = 0;
+  const K& node_key = ExtractKey(node->data_);
+  Node<T>* q = p;
+  while (q) {
+    const K& q_key = ExtractKey(q->data_);
+    bool less = comp_(node_key, q_key);
+    if (!less && !comp_(q_key, node_key)) break;
+    path[depth] = q;
+    is_left[depth] = less;
+    q = is_left[depth++] ? q->left_ : q->right_;
+  }
+  if (!q) return p;
+
+  Node<T>* l = node->left_;
+  Node<T>* r = node->right_;
 
-    node->left_ = nullptr;
-    node->right_ = nullptr;
+  node->left_ = nullptr;
+  node->right_ = nullptr;
+  node->height_ = 1;
+  node->Reset(node->data_);
 
-    if (!r) return q;
+  Node<T>* sub = l;
+  if (r) {
     Node<T>* min = FindMin(r);
     min->right_ = RemoveMin(r);
-    min->left_ = q;
-    return Balance(min);
+    min->left_ = l;
+    sub = Balance(min);
   }
-  return Balance(p);
+  return FixPath(path, is_left, depth, sub);
 }
 
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::Remove(Node<T>* p, Node<T>* node) const {
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::Remove(Node<T>* p,
+                                                  Node<T>* node) const {
   Node<T>* ret = ExtractNode(p, node);
   if (node) delete node;
   return ret;
 }
 
-// Makes a deep copy of ther tree and returns it's root
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::Copy(Node<T>* p) const {
+// Makes a deep copy of ther tree and returns it's root.
+// Walks the tree in preorder with an explicit stack of pending
+// (source, copy) pairs: there is at most one per level.
+// If an allocation fails, the partial copy is freed.
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::Copy(Node<T>* p) const {
   if (!p) return nullptr;
-  Node<T>* t = new Node<T>(p->data_);
-  t->left_ = Copy(p->left_);
-  t->right_ = Copy(p->right_);
-  return t;
+  Node<T>* src[kMaxHeight + 1];
+  Node<T>* dst[kMaxHeight + 1];
+  int top = 0;
+  Node<T>* root = new Node<T>(p->data_);
+  src[top] = p;
+  dst[top++] = root;
+  try {
+    while (top) {
+      Node<T>* s = src[--top];
+      Node<T>* d = dst[top];
+      d->height_ = s->height_;
+      static_cast<NodeSummary<T>&>(*d) = *s;
+      if (s->right_) {
+        d->right_ = new Node<T>(s->right_->data_);
+        src[top] = s->right_;
+        dst[top++] = d->right_;
+      }
+      if (s->left_) {
+        d->left_ = new Node<T>(s->left_->data_);
+        src[top] = s->left_;
+        dst[top++] = d->left_;
+      }
+    }
+  } catch (...) {
+    // the nodes not copied yet are null children of the copy
+    Clear(root);
+    throw;
+  }
+  return root;
 }
 
-// Deletes all the nodes in the three and free memory
-template <typename K, typename T>
-Node<T>* AvlTreeOperations<K, T>::Clear(Node<T>* p) const {
-  if (p) {
-    Clear(p->left_);
-    Clear(p->right_);
-    delete p;
+// Deletes all the nodes in the three and free memory.
+// Rotates left children up until the current node has none and then
+// deletes it, so no stack is needed whatever the shape of the tree.
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::Clear(Node<T>* p) const {
+  return Clear(p, [](Node<T>*) {});
+}
+
+// The same, but calls visit(node) right before deleting each node.
+template <typename K, typename T, typename Compare>
+template <typename Visit>
+Node<T>* AvlTreeOperations<K, T, Compare>::Clear(Node<T>* p,
+                                                 Visit visit) const {
+  while (p) {
+    if (p->left_) {
+      Node<T>* l = p->left_;
+      p->left_ = l->right_;
+      l->right_ = p;
+      p = l;
+    } else {
+      Node<T>* r = p->right_;
+      visit(p);
+      delete p;
+      p = r;
+    }
   }
   return nullptr;
 }
 
+// Splits the tree p into two AVL trees: left gets the nodes with keys
+// less than key (or not greater than key if key_left is set), right
+// gets all the others. Every level joins a subtree with the part built
+// so far, and the costs of the joins telescope to O(log n) in total.
+template <typename K, typename T, typename Compare>
+template <typename KeyLike>
+void AvlTreeOperations<K, T, Compare>::Split(Node<T>* p, const KeyLike& key,
+                                             bool key_left, Node<T>** left,
+                                             Node<T>** right) const {
+  if (!p) {
+    *left = *right = nullptr;
+    return;
+  }
+  const K& p_key = ExtractKey(p->data_);
+  bool goes_left = key_left ? !comp_(key, p_key) : comp_(p_key, key);
+  Node<T>* l = p->left_;
+  Node<T>* r = p->right_;
+  if (goes_left) {
+    Split(r, key, key_left, &r, right);
+    *left = Join(l, p, r);
+  } else {
+    Split(l, key, key_left, left, &l);
+    *right = Join(l, p, r);
+  }
+}
+
+// Joins the trees left and right with the node mid between them. All
+// the keys of left must be less than the key of mid and all the keys
+// of right greater. Descends the spine of the higher tree to a subtree
+// as high as the other tree, hangs them both under mid there and
+// rebalances on the way back: O(|Height(left) - Height(right)| + 1).
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::Join(Node<T>* left, Node<T>* mid,
+                                                Node<T>* right) const {
+  if (Height(left) > Height(right) + 1) {
+    left->right_ = Join(left->right_, mid, right);
+    return Balance(left);
+  }
+  if (Height(right) > Height(left) + 1) {
+    right->left_ = Join(left, mid, right->left_);
+    return Balance(right);
+  }
+  mid->left_ = left;
+  mid->right_ = right;
+  FixHeight(mid);
+  return mid;
+}
+
+// Joins two trees when all the keys of left are less than all the keys
+// of right, using the minimum of right as the middle node.
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::Join(Node<T>* left,
+                                                Node<T>* right) const {
+  if (!left) return right;
+  if (!right) return left;
+  Node<T>* mid = FindMin(right);
+  right = RemoveMin(right);
+  return Join(left, mid, right);
+}
+
+// Builds a perfectly balanced tree from n nodes sorted by the key.
+// Reuses the nodes and allocates nothing.
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::Build(Node<T>** nodes,
+                                                 size_t n) const {
+  if (!n) return nullptr;
+  size_t mid = n / 2;
+  Node<T>* p = nodes[mid];
+  p->left_ = Build(nodes, mid);
+  p->right_ = Build(nodes + mid + 1, n - mid - 1);
+  FixHeight(p);
+  return p;
+}
+
+// Deletes every node whose data satisfy pred (calling visit(node) right
+// before deleting it) and rebuilds the tree from the rest in O(n),
+// instead of rebalancing after each removal. If pred throws, the nodes
+// not yet checked are kept and *root is still a valid tree.
+template <typename K, typename T, typename Compare>
+template <typename Pred, typename Visit>
+void AvlTreeOperations<K, T, Compare>::RemoveIf(Node<T>** root, Pred pred,
+                                                Visit visit) const {
+  std::vector<Node<T>*> nodes;
+  Node<T>* stack[kMaxHeight];
+  int top = 0;
+  for (Node<T>* p = *root; p || top;) {
+    for (; p; p = p->left_) stack[top++] = p;
+    p = stack[--top];
+    nodes.push_back(p);
+    p = p->right_;
+  }
+  size_t kept = 0;
+  size_t i = 0;
+  try {
+    for (; i < nodes.size(); ++i) {
+      if (pred(nodes[i]->data_)) {
+        visit(nodes[i]);
+        delete nodes[i];
+      } else {
+        nodes[kept++] = nodes[i];
+      }
+    }
+  } catch (...) {
+    for (; i < nodes.size(); ++i) nodes[kept++] = nodes[i];
+    *root = Build(nodes.data(), kept);
+    throw;
+  }
+  *root = Build(nodes.data(), kept);
+}
+
+// Copies the top levels of the tree here and hands the subtrees below
+// them to the worker threads, each of which copies its subtrees with
+// Copy. Every worker writes only to its own slots in the new tree.
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::CopyParallel(
+    Node<T>* p, unsigned n_threads) const {
+  Node<T>* root = nullptr;
+  std::vector<Node<T>*> src;
+  std::vector<Node<T>**> dst;
+  try {
+    SplitCopy(p, &root, SplitDepth(n_threads), &src, &dst);
+    RunParallel(src.size(), n_threads,
+                [&](size_t i) { *dst[i] = Copy(src[i]); });
+  } catch (...) {
+    Clear(root);
+    throw;
+  }
+  return root;
+}
+
+// Deletes the top levels of the tree here and the subtrees below them
+// on the worker threads.
+template <typename K, typename T, typename Compare>
+Node<T>* AvlTreeOperations<K, T, Compare>::ClearParallel(
+    Node<T>* p, unsigned n_threads) const {
+  std::vector<Node<T>*> tasks;
+  SplitClear(p, SplitDepth(n_threads), &tasks);
+  RunParallel(tasks.size(), n_threads, [&](size_t i) { Clear(tasks[i]); });
+  return nullptr;
+}
+
+template <typename K, typename T, typename Compare>
+void AvlTreeOperations<K, T, Compare>::SplitCopy(
+    Node<T>* p, Node<T>** slot, int depth, std::vector<Node<T>*>* src,
+    std::vector<Node<T>**>* dst) const {
+  if (!p) {
+    *slot = nullptr;
+  } else if (!depth || p->height_ < kParallelMinHeight) {
+    src->push_back(p);
+    dst->push_back(slot);
+  } else {
+    Node<T>* t = new Node<T>(p->data_);
+    t->height_ = p->height_;
+    static_cast<NodeSummary<T>&>(*t) = *p;
+    *slot = t;
+    SplitCopy(p->left_, &t->left_, depth - 1, src, dst);
+    SplitCopy(p->right_, &t->right_, depth - 1, src, dst);
+  }
+}
+
+template <typename K, typename T, typename Compare>
+void AvlTreeOperations<K, T, Compare>::SplitClear(
+    Node<T>* p, int depth, std::vector<Node<T>*>* tasks) const {
+  if (!p) return;
+  if (!depth || p->height_ < kParallelMinHeight) {
+    tasks->push_back(p);
+  } else {
+    SplitClear(p->left_, depth - 1, tasks);
+    SplitClear(p->right_, depth - 1, tasks);
+    delete p;
+  }
+}
+
+// About four subtrees per thread, so that the threads stay busy
+// even if the subtrees are of different size.
+template <typename K, typename T, typename Compare>
+int AvlTreeOperations<K, T, Compare>::SplitDepth(unsigned n_threads) noexcept {
+  int depth = 2;
+  while (n_threads > 1 && depth < kMaxHeight) {
+    n_threads = (n_threads + 1) / 2;
+    ++depth;
+  }
+  return depth;
+}
+
+// The threads take tasks one by one from a shared counter.
+// With a single thread or task everything runs on the caller's thread,
+// and so does the work of the threads that could not be started.
+// The first exception of a task stops the handing out of tasks and is
+// rethrown here once all the threads are joined.
+template <typename K, typename T, typename Compare>
+template <typename Task>
+void AvlTreeOperations<K, T, Compare>::RunParallel(size_t n_tasks,
+                                                   unsigned n_threads,
+                                                   Task task) {
+  std::atomic<size_t> next{0};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto worker = [&]() {
+    try {
+      for (size_t i = next++; i < n_tasks; i = next++) task(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) error = std::current_exception();
+      next = n_tasks;
+    }
+  };
+  if (n_threads > n_tasks) n_threads = n_tasks;
+  std::vector<std::thread> threads;
+  try {
+    threads.reserve(n_threads);
+    for (unsigned i = 1; i < n_threads; ++i) threads.emplace_back(worker);
+  } catch (const std::exception&) {
+    // fewer threads share the tasks
+  }
+  worker();
+  for (auto& thread : threads) thread.join();
+  if (error) std::rethrow_exception(error);
+}
+
 template <typename K, typename T>
 std::ostream& operator<<(std::ostream& out, const std::pair<K, T>& p) {
   return out << p.first << "[" << p.second << "]";
 }
 
 #ifdef DEBUG
-template <typename K, typename T>
-void AvlTreeOperations<K, T>::Print(Node<T>* p, int level) const {
+template <typename K, typename T, typename Compare>
+void AvlTreeOperations<K, T, Compare>::Print(Node<T>* p, int level) const {
   if (p) {
     Print(p->right_, level + 1);
     for (int i = 0; i < level; ++i) std::cout << "    ";
@@ -4,22 +4,26 @@
 #include <initializer_list>
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "avl_tree_operations.h"
+#include "node_handle.h"
 
 namespace s21 {
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare = std::less<Key>>
 class BinaryTree;
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare>
 class BinaryTreeBaseIterator {
-  friend class BinaryTree<Key, T>;
+  friend class BinaryTree<Key, T, Compare>;
 
  public:
   BinaryTreeBaseIterator() = default;
 
-  BinaryTreeBaseIterator(const BinaryTree<Key, T> *owner, Node<T> *p)
+  BinaryTreeBaseIterator(const BinaryTree<Key, T, Compare> *owner, Node<T> *p)
       : owner_(owner), p_(p) {}
 
   BinaryTreeBaseIterator &operator++() {
@@ -37,55 +41,63 @@ class BinaryTreeBaseIterator {
 
  protected:
   // owner_ - a pointer to the tree we iterate over
-  const BinaryTree<Key, T> *owner_ = nullptr;
+  const BinaryTree<Key, T, Compare> *owner_ = nullptr;
 
   // p_ - a pointer to the current node
   Node<T> *p_ = nullptr;
 };
 
-template <typename Key, typename T>
-class ConstBinaryTreeIterator : public BinaryTreeBaseIterator<Key, T> {
-  friend class BinaryTree<Key, T>;
-  using BinaryTreeBaseIterator<Key, T>::p_;
+template <typename Key, typename T, typename Compare>
+class ConstBinaryTreeIterator : public BinaryTreeBaseIterator<Key, T, Compare> {
+  friend class BinaryTree<Key, T, Compare>;
+  using BinaryTreeBaseIterator<Key, T, Compare>::p_;
 
  public:
   ConstBinaryTreeIterator() = default;
 
-  ConstBinaryTreeIterator(const BinaryTree<Key, T> *owner, Node<T> *p)
-      : BinaryTreeBaseIterator<Key, T>(owner, p) {}
+  ConstBinaryTreeIterator(const BinaryTree<Key, T, Compare> *owner, Node<T> *p)
+      : BinaryTreeBaseIterator<Key, T, Compare>(owner, p) {}
 
-  typename BinaryTree<Key, T>::const_reference operator*() { return p_->data_; }
+  typename BinaryTree<Key, T, Compare>::const_reference operator*() {
+    return p_->data_;
+  }
 
   const T *operator->() { return &(p_->data_); }
 };
 
-template <typename Key, typename T>
-class BinaryTreeIterator : public BinaryTreeBaseIterator<Key, T> {
-  friend class BinaryTree<Key, T>;
-  using BinaryTreeBaseIterator<Key, T>::owner_;
-  using BinaryTreeBaseIterator<Key, T>::p_;
+template <typename Key, typename T, typename Compare>
+class BinaryTreeIterator : public BinaryTreeBaseIterator<Key, T, Compare> {
+  friend class BinaryTree<Key, T, Compare>;
+  using BinaryTreeBaseIterator<Key, T, Compare>::owner_;
+  using BinaryTreeBaseIterator<Key, T, Compare>::p_;
 
  public:
   BinaryTreeIterator() = default;
 
-  BinaryTreeIterator(const BinaryTree<Key, T> *owner, Node<T> *p)
-      : BinaryTreeBaseIterator<Key, T>(owner, p) {}
+  BinaryTreeIterator(const BinaryTree<Key, T, Compare> *owner, Node<T> *p)
+      : BinaryTreeBaseIterator<Key, T, Compare>(owner, p) {}
 
-  typename BinaryTree<Key, T>::reference operator*() { return p_->data_; }
+  typename BinaryTree<Key, T, Compare>::reference operator*() {
+    return p_->data_;
+  }
 
   T *operator->() { return &(p_->data_); }
 
   // Allows conversion from an iterator to a const_iterator
-  operator ConstBinaryTreeIterator<Key, T>() {
-    return ConstBinaryTreeIterator<Key, T>(owner_, p_);
+  operator ConstBinaryTreeIterator<Key, T, Compare>() {
+    return ConstBinaryTreeIterator<Key, T, Compare>(owner_, p_);
   }
 };
 
 // T - type of all the data to store, Key - type of the key.
 // The key is used to compare and arrange nodes in the tree.
-template <typename Key, typename T>
+// Compare orders the keys. If it declares is_transparent (like
+// std::less<>), the lookup functions also take any type comparable
+// with the key, so that e.g. a std::string_view can be looked up in a
+// tree of std::string without building a temporary key.
+template <typename Key, typename T, typename Compare>
 class BinaryTree {
-  friend class BinaryTreeBaseIterator<Key, T>;
+  friend class BinaryTreeBaseIterator<Key, T, Compare>;
 
  public:
   // Member type
@@ -93,11 +105,21 @@ class BinaryTree {
   using value_type = T;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = BinaryTreeIterator<Key, T>;
-  using const_iterator = ConstBinaryTreeIterator<Key, T>;
+  using iterator = BinaryTreeIterator<Key, T, Compare>;
+  using const_iterator = ConstBinaryTreeIterator<Key, T, Compare>;
   using size_type = size_t;
+  using node_type = TreeNodeHandle<T>;
+
+  // The result of insert(node_type&&): if the key was already there,
+  // the node stays in the handle and position points to the element
+  // that prevented the insertion.
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
 
-  using key_extractor_type = Key (*)(const T &);
+  using key_extractor_type = const Key &(*)(const T &);
 
   // Functions
   BinaryTree() = default;
@@ -119,42 +141,124 @@ class BinaryTree {
   // Modifiers
   void clear();
   std::pair<iterator, bool> insert(const value_type &value);
+  iterator insert(const_iterator hint, const value_type &value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args);
+  insert_return_type insert(node_type &&nh);
+  node_type extract(const_iterator pos);
+  node_type extract(const key_type &key);
   void erase(iterator pos);
+  size_type erase(const key_type &key);
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent,
+            typename = std::enable_if_t<
+                !std::is_convertible<KeyLike, const_iterator>::value>>
+  size_type erase(const KeyLike &key);
+  iterator erase(const_iterator first, const_iterator last);
+  template <typename Pred>
+  size_type erase_if(Pred pred);
+  size_type erase_below(const key_type &key);
+  size_type erase_above(const key_type &key);
   void swap(BinaryTree &other) noexcept;
   void merge(BinaryTree &other);
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last);
 
   // Lookup
-  iterator find(const key_type &val) const noexcept;
-  bool contains(const key_type &val) const noexcept;
+  size_type count(const key_type &key) const noexcept;
+  iterator find(const key_type &key) const noexcept;
+  bool contains(const key_type &key) const noexcept;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+
+  // Heterogeneous lookup, only for a transparent Compare
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const KeyLike &key) const noexcept;
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const KeyLike &key) const noexcept;
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const KeyLike &key) const noexcept;
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const KeyLike &key) const noexcept;
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const KeyLike &key) const noexcept;
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const KeyLike &key) const noexcept;
+
+  // Interval trees, whose keys are s21::interval: the elements whose
+  // intervals have a point in common with [lo, hi] or contain the point,
+  // in key order
+  template <typename U = T, typename Traits = IntervalTraits<U>>
+  std::vector<iterator> overlapping(
+      const typename Traits::endpoint_type &lo,
+      const typename Traits::endpoint_type &hi) const;
+  template <typename U = T, typename Traits = IntervalTraits<U>>
+  std::vector<iterator> stabbing(
+      const typename Traits::endpoint_type &point) const;
+
+  // Parallelism
+  void set_parallel_destruction(unsigned n_threads) noexcept;
 
   // Debug
   void print();
 
+ protected:
+  // Deep copy made by n_threads threads; the derived containers
+  // expose it as copy_parallel().
+  BinaryTree(const BinaryTree &other, unsigned n_threads);
+
+  // Inserts an element constructed from args if there is no element
+  // with the key. Descends the tree once and constructs nothing if the
+  // key is already there.
+  template <typename... Args>
+  std::pair<iterator, bool> EmplaceKey(const key_type &key, Args &&...args);
+
  private:
   Node<T> *root_ = nullptr;
   size_type size_ = 0;
 
+  // Number of threads used by clear() and the destructor.
+  // It goes with the nodes on swap and move, so the old tree of an
+  // assigned container is still destroyed in parallel; copies start at 1.
+  unsigned destroy_threads_ = 1;
+
   // It shows how to extract the key from the data
   // and by default the data are itself the key.
-  key_extractor_type key_extractor_{[](const T &data) -> Key { return data; }};
+  key_extractor_type key_extractor_{
+      [](const T &data) -> const Key & { return data; }};
+
+  template <typename KeyLike>
+  size_type EraseKey(const KeyLike &key);
+  iterator InsertNodeHint(Node<T> *hint, Node<T> *node);
+
+  using Position = typename AvlTreeOperations<Key, T, Compare>::Position;
 
   // Contains all the operations to operate with AVL-Tree.
-  AvlTreeOperations<Key, T> avl_oper_{key_extractor_};
+  AvlTreeOperations<Key, T, Compare> avl_oper_{key_extractor_};
 };
 
 // Functions
-template <typename Key, typename T>
-BinaryTree<Key, T>::BinaryTree(
+template <typename Key, typename T, typename Compare>
+BinaryTree<Key, T, Compare>::BinaryTree(
     // Construct a tree with user-defined key_extractor function
-    typename BinaryTree<Key, T>::key_extractor_type key_extractor)
+    typename BinaryTree<Key, T, Compare>::key_extractor_type key_extractor)
     : root_(nullptr),
       size_(0),
       key_extractor_{key_extractor},
       avl_oper_{key_extractor} {}
 
 // copy constructor
-template <typename Key, typename T>
-BinaryTree<Key, T>::BinaryTree(const BinaryTree &other)
+template <typename Key, typename T, typename Compare>
+BinaryTree<Key, T, Compare>::BinaryTree(const BinaryTree &other)
     : root_(nullptr),
       size_(other.size_),
       key_extractor_(other.key_extractor_),
@@ -162,105 +266,300 @@ BinaryTree<Key, T>::BinaryTree(const BinaryTree &other)
   root_ = avl_oper_.Copy(other.root_);
 }
 
+// parallel copy constructor
+template <typename Key, typename T, typename Compare>
+BinaryTree<Key, T, Compare>::BinaryTree(const BinaryTree &other,
+                                        unsigned n_threads)
+    : root_(nullptr),
+      size_(other.size_),
+      key_extractor_(other.key_extractor_),
+      avl_oper_(other.avl_oper_) {
+  root_ = avl_oper_.CopyParallel(other.root_, n_threads);
+}
+
 // move constructor
-template <typename Key, typename T>
-BinaryTree<Key, T>::BinaryTree(BinaryTree &&other) noexcept {
+template <typename Key, typename T, typename Compare>
+BinaryTree<Key, T, Compare>::BinaryTree(BinaryTree &&other) noexcept {
   swap(other);
 }
 
 // desturctor
-template <typename Key, typename T>
-BinaryTree<Key, T>::~BinaryTree() {
-  avl_oper_.Clear(root_);
+template <typename Key, typename T, typename Compare>
+BinaryTree<Key, T, Compare>::~BinaryTree() {
+  clear();
 }
 
 // replaces copy and move operator=
 // https://stackoverflow.com/questions/3279543/what-is-the-copy-and-swap-idiom
-template <typename Key, typename T>
-BinaryTree<Key, T> &BinaryTree<Key, T>::operator=(BinaryTree<Key, T> other) {
+template <typename Key, typename T, typename Compare>
+BinaryTree<Key, T, Compare> &BinaryTree<Key, T, Compare>::operator=(
+    BinaryTree<Key, T, Compare> other) {
   swap(other);
   return *this;
 }
 
 // Iterators
-template <typename Key, typename T>
-typename BinaryTree<Key, T>::iterator BinaryTree<Key, T>::begin()
-    const noexcept {
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::iterator
+BinaryTree<Key, T, Compare>::begin() const noexcept {
   Node<T> *p = root_;
   while (p && p->left_) p = p->left_;
-  return BinaryTreeIterator<Key, T>(this, p);
+  return BinaryTreeIterator<Key, T, Compare>(this, p);
 }
 
-template <typename Key, typename T>
-typename BinaryTree<Key, T>::iterator BinaryTree<Key, T>::end() const noexcept {
-  return BinaryTreeIterator<Key, T>(this, nullptr);
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::iterator
+BinaryTree<Key, T, Compare>::end() const noexcept {
+  return BinaryTreeIterator<Key, T, Compare>(this, nullptr);
 }
 
 // Capacity
-template <typename Key, typename T>
-bool BinaryTree<Key, T>::empty() const noexcept {
+template <typename Key, typename T, typename Compare>
+bool BinaryTree<Key, T, Compare>::empty() const noexcept {
   return root_ == nullptr;
 }
 
-template <typename Key, typename T>
-typename BinaryTree<Key, T>::size_type BinaryTree<Key, T>::size()
-    const noexcept {
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::size() const noexcept {
   return size_;
 }
 
-template <typename Key, typename T>
-typename BinaryTree<Key, T>::size_type BinaryTree<Key, T>::max_size()
-    const noexcept {
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::max_size() const noexcept {
   return (~(size_type(0))) / sizeof(Node<T>);
 }
 
 // Modifiers
 // clears the contents
-template <typename Key, typename T>
-void BinaryTree<Key, T>::clear() {
-  root_ = avl_oper_.Clear(root_);
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::clear() {
+  if (destroy_threads_ > 1)
+    root_ = avl_oper_.ClearParallel(root_, destroy_threads_);
+  else
+    root_ = avl_oper_.Clear(root_);
   size_ = 0;
 }
 
 // inserts a node and returns an iterator to where the element
 // is in the container and bool denoting whether the insertion took place
-template <typename Key, typename T>
-std::pair<BinaryTreeIterator<Key, T>, bool> BinaryTree<Key, T>::insert(
-    const value_type &value) {
-  BinaryTreeIterator<Key, T> it = find(key_extractor_(value));
-  if (it != end()) {
-    return {it, false};
+template <typename Key, typename T, typename Compare>
+std::pair<BinaryTreeIterator<Key, T, Compare>, bool>
+BinaryTree<Key, T, Compare>::insert(const value_type &value) {
+  return EmplaceKey(key_extractor_(value), value);
+}
+
+// inserts the value as close as possible to the position just before
+// hint; inserting sorted data with end() as the hint takes a single
+// key comparison per element
+template <typename Key, typename T, typename Compare>
+BinaryTreeIterator<Key, T, Compare> BinaryTree<Key, T, Compare>::insert(
+    const_iterator hint, const value_type &value) {
+  return emplace_hint(hint, value);
+}
+
+// constructs the element in place and inserts it if its key is absent
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+std::pair<BinaryTreeIterator<Key, T, Compare>, bool>
+BinaryTree<Key, T, Compare>::emplace(Args &&...args) {
+  Node<T> *node = new Node<T>(std::in_place, std::forward<Args>(args)...);
+  Position pos;
+  Node<T> *found = avl_oper_.FindPosition(root_, key_extractor_(node->data_),
+                                          &pos);
+  if (found) {
+    delete node;
+    return {iterator(this, found), false};
+  }
+  root_ = avl_oper_.InsertAt(&pos, node);
+  ++size_;
+  return {iterator(this, node), true};
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+BinaryTreeIterator<Key, T, Compare> BinaryTree<Key, T, Compare>::emplace_hint(
+    const_iterator hint, Args &&...args) {
+  Node<T> *node = new Node<T>(std::in_place, std::forward<Args>(args)...);
+  return InsertNodeHint(hint.p_, node);
+}
+
+// Nodes have no parent pointers, so the path to the new node is needed
+// for rebalancing anyway. A hint at either end lets us take it along
+// the spine without comparing keys; other hints fall back to a search.
+template <typename Key, typename T, typename Compare>
+BinaryTreeIterator<Key, T, Compare> BinaryTree<Key, T, Compare>::InsertNodeHint(
+    Node<T> *hint, Node<T> *node) {
+  Position pos;
+  const Key &key = key_extractor_(node->data_);
+  if (!avl_oper_.FindEdgePosition(root_, hint, key, &pos)) {
+    Node<T> *found = avl_oper_.FindPosition(root_, key, &pos);
+    if (found) {
+      delete node;
+      return iterator(this, found);
+    }
   }
+  root_ = avl_oper_.InsertAt(&pos, node);
+  ++size_;
+  return iterator(this, node);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+std::pair<BinaryTreeIterator<Key, T, Compare>, bool>
+BinaryTree<Key, T, Compare>::EmplaceKey(const key_type &key, Args &&...args) {
+  Position pos;
+  Node<T> *found = avl_oper_.FindPosition(root_, key, &pos);
+  if (found) return {iterator(this, found), false};
+
+  Node<T> *node = new Node<T>(std::in_place, std::forward<Args>(args)...);
+  root_ = avl_oper_.InsertAt(&pos, node);
+  ++size_;
+  return {iterator(this, node), true};
+}
+
+// inserts the node owned by the handle without reallocating it
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::insert_return_type
+BinaryTree<Key, T, Compare>::insert(node_type &&nh) {
+  if (nh.empty()) return {end(), false, node_type()};
 
-  root_ = avl_oper_.Insert(root_, value);
+  Position pos;
+  Node<T> *found = avl_oper_.FindPosition(
+      root_, key_extractor_(nh.node_->data_), &pos);
+  if (found) return {iterator(this, found), false, std::move(nh)};
+
+  Node<T> *node = nh.Release();
+  root_ = avl_oper_.InsertAt(&pos, node);
   ++size_;
-  return {find(key_extractor_(value)), true};
+  return {iterator(this, node), true, node_type()};
+}
+
+// unlinks the node at pos from the tree and hands it over to the caller
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::node_type
+BinaryTree<Key, T, Compare>::extract(const_iterator pos) {
+  root_ = avl_oper_.ExtractNode(root_, pos.p_);
+  --size_;
+  return node_type(pos.p_);
+}
+
+// returns an empty handle if there is no such key
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::node_type
+BinaryTree<Key, T, Compare>::extract(const key_type &key) {
+  Node<T> *p = avl_oper_.Find(root_, key);
+  if (!p) return node_type();
+  return extract(const_iterator(this, p));
 }
 
 // erases an element at pos
-template <typename Key, typename T>
-void BinaryTree<Key, T>::erase(BinaryTreeIterator<Key, T> pos) {
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::erase(
+    BinaryTreeIterator<Key, T, Compare> pos) {
   root_ = avl_oper_.Remove(root_, pos.p_);
   --size_;
 }
 
+// erases the element with the key (if any) and returns
+// the number of erased elements
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::erase(const key_type &key) {
+  return EraseKey(key);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename KeyLike, typename C, typename, typename>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::erase(const KeyLike &key) {
+  return EraseKey(key);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename KeyLike>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::EraseKey(const KeyLike &key) {
+  Node<T> *p = avl_oper_.Find(root_, key);
+  if (!p) return 0;
+  root_ = avl_oper_.Remove(root_, p);
+  --size_;
+  return 1;
+}
+
+// erases the elements in [first, last) and returns last. Cuts the
+// range out with two splits and a join, so it takes O(k + log n) for k
+// erased elements instead of a descent and a rebalance for each.
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::iterator
+BinaryTree<Key, T, Compare>::erase(const_iterator first, const_iterator last) {
+  if (first == last) return iterator(this, last.p_);
+  Node<T> *left, *mid, *right = nullptr;
+  avl_oper_.Split(root_, key_extractor_(first.p_->data_), false, &left, &mid);
+  if (last.p_)
+    avl_oper_.Split(mid, key_extractor_(last.p_->data_), false, &mid, &right);
+  avl_oper_.Clear(mid, [this](Node<T> *) { --size_; });
+  root_ = avl_oper_.Join(left, right);
+  return iterator(this, last.p_);
+}
+
+// erases all the elements satisfying pred and returns their number.
+// Checks every element once and rebuilds the tree from the rest in
+// O(n).
+template <typename Key, typename T, typename Compare>
+template <typename Pred>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::erase_if(Pred pred) {
+  size_type old_size = size_;
+  avl_oper_.RemoveIf(
+      &root_, [&pred](const T &data) -> bool { return pred(data); },
+      [this](Node<T> *) { --size_; });
+  return old_size - size_;
+}
+
+// erases all the elements with keys less than key in O(k + log n)
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::erase_below(const key_type &key) {
+  size_type old_size = size_;
+  Node<T> *below;
+  avl_oper_.Split(root_, key, false, &below, &root_);
+  avl_oper_.Clear(below, [this](Node<T> *) { --size_; });
+  return old_size - size_;
+}
+
+// erases all the elements with keys greater than key in O(k + log n)
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::erase_above(const key_type &key) {
+  size_type old_size = size_;
+  Node<T> *above;
+  avl_oper_.Split(root_, key, true, &root_, &above);
+  avl_oper_.Clear(above, [this](Node<T> *) { --size_; });
+  return old_size - size_;
+}
+
 // swaps the contents
-template <typename Key, typename T>
-void BinaryTree<Key, T>::swap(BinaryTree<Key, T> &other) noexcept {
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::swap(
+    BinaryTree<Key, T, Compare> &other) noexcept {
   using std::swap;
   swap(root_, other.root_);
   swap(size_, other.size_);
   swap(key_extractor_, other.key_extractor_);
   swap(avl_oper_, other.avl_oper_);
+  swap(destroy_threads_, other.destroy_threads_);
 }
 
 // Splices nodes from another container.
 // Only the internal pointers of the container nodes are repointed.
-template <typename Key, typename T>
-void BinaryTree<Key, T>::merge(BinaryTree<Key, T> &other) {  // NOLINT
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::merge(
+    BinaryTree<Key, T, Compare> &other) {  // NOLINT
   Node<T> *p = other.begin().p_;
   while (p) {
-    Key p_key = other.key_extractor_(p->data_);
+    const Key &p_key = other.key_extractor_(p->data_);
     if (!avl_oper_.Find(root_, p_key)) {
       Node<T> *node = p;
       p = other.avl_oper_.Next(other.root_, p);
@@ -277,22 +576,154 @@ void BinaryTree<Key, T>::merge(BinaryTree<Key, T> &other) {  // NOLINT
 }
 
 // Lookup
+// returns the number of elements with a specific key (0 or 1)
+template <typename Key, typename T, typename Compare>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::count(const key_type &key) const noexcept {
+  return avl_oper_.Find(root_, key) ? 1 : 0;
+}
+
 // finds an element with a specific key
-template <typename Key, typename T>
-BinaryTreeIterator<Key, T> BinaryTree<Key, T>::find(
+template <typename Key, typename T, typename Compare>
+BinaryTreeIterator<Key, T, Compare> BinaryTree<Key, T, Compare>::find(
     const key_type &key) const noexcept {
-  return BinaryTreeIterator<Key, T>(this, avl_oper_.Find(root_, key));
+  return BinaryTreeIterator<Key, T, Compare>(this, avl_oper_.Find(root_, key));
 }
 
 // checks if the container contains an element with a specific key
-template <typename Key, typename T>
-bool BinaryTree<Key, T>::contains(const key_type &key) const noexcept {
+template <typename Key, typename T, typename Compare>
+bool BinaryTree<Key, T, Compare>::contains(const key_type &key) const noexcept {
   return avl_oper_.Find(root_, key);
 }
 
+// returns the range of the elements with the key: one element or none
+template <typename Key, typename T, typename Compare>
+std::pair<BinaryTreeIterator<Key, T, Compare>,
+          BinaryTreeIterator<Key, T, Compare>>
+BinaryTree<Key, T, Compare>::equal_range(const key_type &key) const noexcept {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+// returns an iterator to the first element not less than the key
+template <typename Key, typename T, typename Compare>
+BinaryTreeIterator<Key, T, Compare> BinaryTree<Key, T, Compare>::lower_bound(
+    const key_type &key) const noexcept {
+  return BinaryTreeIterator<Key, T, Compare>(
+      this, avl_oper_.LowerBound(root_, key));
+}
+
+// returns an iterator to the first element greater than the key
+template <typename Key, typename T, typename Compare>
+BinaryTreeIterator<Key, T, Compare> BinaryTree<Key, T, Compare>::upper_bound(
+    const key_type &key) const noexcept {
+  return BinaryTreeIterator<Key, T, Compare>(
+      this, avl_oper_.UpperBound(root_, key));
+}
+
+// Heterogeneous lookup
+template <typename Key, typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+typename BinaryTree<Key, T, Compare>::size_type
+BinaryTree<Key, T, Compare>::count(const KeyLike &key) const noexcept {
+  return avl_oper_.Find(root_, key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+BinaryTreeIterator<Key, T, Compare> BinaryTree<Key, T, Compare>::find(
+    const KeyLike &key) const noexcept {
+  return BinaryTreeIterator<Key, T, Compare>(this, avl_oper_.Find(root_, key));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+bool BinaryTree<Key, T, Compare>::contains(const KeyLike &key) const noexcept {
+  return avl_oper_.Find(root_, key);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+std::pair<BinaryTreeIterator<Key, T, Compare>,
+          BinaryTreeIterator<Key, T, Compare>>
+BinaryTree<Key, T, Compare>::equal_range(const KeyLike &key) const noexcept {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+BinaryTreeIterator<Key, T, Compare> BinaryTree<Key, T, Compare>::lower_bound(
+    const KeyLike &key) const noexcept {
+  return BinaryTreeIterator<Key, T, Compare>(
+      this, avl_oper_.LowerBound(root_, key));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+BinaryTreeIterator<Key, T, Compare> BinaryTree<Key, T, Compare>::upper_bound(
+    const KeyLike &key) const noexcept {
+  return BinaryTreeIterator<Key, T, Compare>(
+      this, avl_oper_.UpperBound(root_, key));
+}
+
+// Interval trees
+template <typename Key, typename T, typename Compare>
+template <typename U, typename Traits>
+std::vector<BinaryTreeIterator<Key, T, Compare>>
+BinaryTree<Key, T, Compare>::overlapping(
+    const typename Traits::endpoint_type &lo,
+    const typename Traits::endpoint_type &hi) const {
+  std::vector<iterator> res;
+  avl_oper_.Overlapping(root_, lo, hi, [this, &res](Node<T> *p) {
+    res.emplace_back(this, p);
+  });
+  return res;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename U, typename Traits>
+std::vector<BinaryTreeIterator<Key, T, Compare>>
+BinaryTree<Key, T, Compare>::stabbing(
+    const typename Traits::endpoint_type &point) const {
+  return overlapping(point, point);
+}
+
+// Replaces the contents with [first, last), which must be sorted by
+// the key without duplicates (otherwise std::invalid_argument is thrown
+// and the tree is left as it was). Builds a balanced tree in O(n)
+// instead of n insertions with rebalancing.
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+void BinaryTree<Key, T, Compare>::assign_sorted(InputIt first, InputIt last) {
+  std::vector<Node<T> *> nodes;
+  try {
+    for (; first != last; ++first) {
+      nodes.push_back(nullptr);
+      nodes.back() = new Node<T>(std::in_place, *first);
+      if (nodes.size() > 1 &&
+          !avl_oper_.Less(key_extractor_(nodes[nodes.size() - 2]->data_),
+                          key_extractor_(nodes.back()->data_)))
+        throw std::invalid_argument("assign_sorted: the range isn't sorted");
+    }
+  } catch (...) {
+    for (Node<T> *p : nodes) delete p;
+    throw;
+  }
+  clear();
+  root_ = avl_oper_.Build(nodes.data(), nodes.size());
+  size_ = nodes.size();
+}
+
+// Parallelism
+// Makes clear() and the destructor free the nodes on n_threads threads.
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::set_parallel_destruction(
+    unsigned n_threads) noexcept {
+  destroy_threads_ = n_threads;
+}
+
 // Debug
-template <typename Key, typename T>
-void BinaryTree<Key, T>::print() {
+template <typename Key, typename T, typename Compare>
+void BinaryTree<Key, T, Compare>::print() {
   avl_oper_.Print(root_);
 }
 
@@ -0,0 +1,86 @@
+#ifndef S21_CONTAINERS_INTERVAL_H_  // NOLINT
+#define S21_CONTAINERS_INTERVAL_H_  // NOLINT
+
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// The closed interval [lo, hi]. Intervals are ordered by lo and then by
+// hi, so a set or a map keyed by them keeps one element per interval.
+template <typename E>
+struct interval {
+  E lo;
+  E hi;
+
+  // True if the intervals have a point in common
+  bool overlaps(const E &from, const E &to) const {
+    return !(to < lo) && !(hi < from);
+  }
+  bool contains(const E &point) const { return overlaps(point, point); }
+
+  friend bool operator<(const interval &a, const interval &b) {
+    return a.lo < b.lo || (!(b.lo < a.lo) && a.hi < b.hi);
+  }
+  friend bool operator==(const interval &a, const interval &b) {
+    return !(a < b) && !(b < a);
+  }
+  friend bool operator!=(const interval &a, const interval &b) {
+    return !(a == b);
+  }
+};
+
+// Finds the interval in the data of a tree node: the data itself for
+// s21::set, the key for s21::map. Only defined for these two.
+template <typename T>
+struct IntervalTraits;
+
+template <typename E>
+struct IntervalTraits<interval<E>> {
+  using endpoint_type = E;
+  static const interval<E> &Get(const interval<E> &data) { return data; }
+};
+
+template <typename E, typename V>
+struct IntervalTraits<std::pair<const interval<E>, V>> {
+  using endpoint_type = E;
+  static const interval<E> &Get(const std::pair<const interval<E>, V> &data) {
+    return data.first;
+  }
+};
+
+// What a tree node knows about its whole subtree besides its height,
+// updated together with it. Nothing for most trees: the node derives
+// from the summary, so an empty one takes no space.
+template <typename T, typename = void>
+struct NodeSummary {
+  void Reset(const T &) noexcept {}
+  void Update(const T &, const NodeSummary *, const NodeSummary *) noexcept {}
+  bool operator==(const NodeSummary &) const noexcept { return true; }
+};
+
+// In a tree of intervals it is the greatest hi of the subtree, which
+// tells the overlap queries which subtrees hold no answer
+template <typename T>
+struct NodeSummary<T,
+                   std::void_t<typename IntervalTraits<T>::endpoint_type>> {
+  using E = typename IntervalTraits<T>::endpoint_type;
+
+  void Reset(const T &data) { max_hi_ = IntervalTraits<T>::Get(data).hi; }
+  void Update(const T &data, const NodeSummary *left,
+              const NodeSummary *right) {
+    const E *max = &IntervalTraits<T>::Get(data).hi;
+    if (left && *max < left->max_hi_) max = &left->max_hi_;
+    if (right && *max < right->max_hi_) max = &right->max_hi_;
+    max_hi_ = *max;
+  }
+  bool operator==(const NodeSummary &other) const {
+    return !(max_hi_ < other.max_hi_) && !(other.max_hi_ < max_hi_);
+  }
+
+  E max_hi_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_INTERVAL_H_  // NOLINT
@@ -0,0 +1,86 @@
+#ifndef S21_CONTAINERS_NODE_HANDLE_H_  // NOLINT
+#define S21_CONTAINERS_NODE_HANDLE_H_  // NOLINT
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "avl_tree_operations.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Compare>
+class BinaryTree;
+
+template <typename T, typename Compare>
+class multiset;
+
+// Owns a node extracted from a tree container (see extract()) until it
+// is inserted into another container of the same type with
+// insert(node_type&&). Moving an element this way neither allocates
+// nor copies it. Data - type of the data stored in the node, Value -
+// the element the container exposes (the same for set and map, the
+// key of the counter pair for multiset).
+template <typename Data, typename Value = Data>
+class TreeNodeHandle {
+  template <typename, typename, typename>
+  friend class BinaryTree;
+  template <typename, typename>
+  friend class multiset;
+
+ public:
+  using value_type = Value;
+
+  TreeNodeHandle() noexcept = default;
+  TreeNodeHandle(const TreeNodeHandle &other) = delete;
+  TreeNodeHandle(TreeNodeHandle &&other) noexcept { swap(other); }
+  ~TreeNodeHandle() { delete node_; }
+
+  TreeNodeHandle &operator=(const TreeNodeHandle &other) = delete;
+  TreeNodeHandle &operator=(TreeNodeHandle &&other) noexcept {
+    TreeNodeHandle tmp(std::move(other));
+    swap(tmp);
+    return *this;
+  }
+
+  bool empty() const noexcept { return node_ == nullptr; }
+  explicit operator bool() const noexcept { return node_ != nullptr; }
+
+  // The element of a set or multiset node or the pair of a map node.
+  value_type &value() const { return Get(node_->data_); }
+
+  // The key and the mapped value of a map node.
+  template <typename D = Data>
+  const typename D::first_type &key() const {
+    return node_->data_.first;
+  }
+  template <typename D = Data>
+  typename D::second_type &mapped() const {
+    return node_->data_.second;
+  }
+
+  void swap(TreeNodeHandle &other) noexcept { std::swap(node_, other.node_); }
+
+ private:
+  explicit TreeNodeHandle(Node<Data> *node) noexcept : node_(node) {}
+
+  // Gives up the ownership of the node.
+  Node<Data> *Release() noexcept {
+    Node<Data> *node = node_;
+    node_ = nullptr;
+    return node;
+  }
+
+  static value_type &Get(Data &data) {
+    if constexpr (std::is_same<Data, Value>::value)
+      return data;
+    else
+      return data.first;
+  }
+
+  Node<Data> *node_ = nullptr;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_NODE_HANDLE_H_  // NOLINT
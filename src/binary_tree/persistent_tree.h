@@ -0,0 +1,507 @@
+// Persistent (immutable) AVL tree with structural sharing.
+// Nodes are never modified after they are built: every update copies only
+// the nodes on the path from the root to the changed node (path copying)
+// and shares all the other subtrees with the previous version. Nodes are
+// reference counted, so every version keeps alive exactly the nodes it
+// can reach and old versions stay readable without any locks.
+
+#ifndef S21_CONTAINERS_PERSISTENT_TREE_H_  // NOLINT
+#define S21_CONTAINERS_PERSISTENT_TREE_H_  // NOLINT
+
+#include <atomic>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+template <typename T>
+struct PersistentNode {
+  PersistentNode(const T &data, const PersistentNode *left,
+                 const PersistentNode *right, unsigned char height)
+      : data_(data), left_(left), right_(right), height_(height), refs_(1) {}
+
+  const T data_;
+  const PersistentNode *const left_;
+  const PersistentNode *const right_;
+  const unsigned char height_;
+
+  // Number of parent nodes and trees that share this node.
+  mutable std::atomic<size_t> refs_;
+};
+
+template <typename Key, typename T>
+class PersistentTree;
+
+template <typename Key, typename T>
+class PersistentTreeIterator {
+  friend class PersistentTree<Key, T>;
+
+ public:
+  PersistentTreeIterator() = default;
+
+  PersistentTreeIterator(const PersistentTree<Key, T> *owner,
+                         const PersistentNode<T> *p)
+      : owner_(owner), p_(p) {}
+
+  const T &operator*() const { return p_->data_; }
+  const T *operator->() const { return &(p_->data_); }
+
+  PersistentTreeIterator &operator++() {
+    p_ = owner_->Next(p_);
+    return *this;
+  }
+
+  PersistentTreeIterator &operator--() {
+    p_ = owner_->Prev(p_);
+    return *this;
+  }
+
+  bool operator==(PersistentTreeIterator other) const {
+    return p_ == other.p_;
+  }
+  bool operator!=(PersistentTreeIterator other) const {
+    return p_ != other.p_;
+  }
+
+ private:
+  // owner_ - a pointer to the tree version we iterate over
+  const PersistentTree<Key, T> *owner_ = nullptr;
+
+  // p_ - a pointer to the current node
+  const PersistentNode<T> *p_ = nullptr;
+};
+
+// T - type of all the data to store, Key - type of the key.
+// Copying a tree (or calling snapshot()) is O(1): both trees share all
+// the nodes, and later updates of one of them never affect the other.
+// Different versions may be read and destroyed from different threads,
+// but a single tree object must not be modified concurrently.
+template <typename Key, typename T>
+class PersistentTree {
+  friend class PersistentTreeIterator<Key, T>;
+
+ public:
+  // Member type
+  using key_type = Key;
+  using value_type = T;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = PersistentTreeIterator<Key, T>;
+  using const_iterator = PersistentTreeIterator<Key, T>;
+  using size_type = size_t;
+
+  using key_extractor_type = const Key &(*)(const T &);
+
+  // Functions
+  PersistentTree() = default;
+  explicit PersistentTree(key_extractor_type key_extractor);
+  PersistentTree(const PersistentTree &other) noexcept;
+  PersistentTree(PersistentTree &&other) noexcept;
+  ~PersistentTree();
+  PersistentTree &operator=(PersistentTree other) noexcept;
+
+  // Returns an immutable version of the tree in O(1).
+  PersistentTree snapshot() const noexcept;
+
+  // Iterators
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  // Capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+
+  // Modifiers
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert_or_assign(const value_type &value);
+  size_type erase(const key_type &key);
+  void erase(iterator pos);
+  void swap(PersistentTree &other) noexcept;
+
+  // Lookup
+  iterator find(const key_type &key) const noexcept;
+  bool contains(const key_type &key) const noexcept;
+
+ private:
+  using Node = PersistentNode<T>;
+
+  // Reference counting. Every function below that returns a Node *
+  // returns an owned reference, and every Node * argument named
+  // 'left'/'right' is consumed, even if the function throws.
+  static const Node *Retain(const Node *p) noexcept;
+  static void Release(const Node *p) noexcept;
+
+  // Owns a reference until it is handed on with Take()
+  class Owned {
+   public:
+    explicit Owned(const Node *p) noexcept : p_(p) {}
+    Owned(const Owned &) = delete;
+    Owned &operator=(const Owned &) = delete;
+    ~Owned() { Release(p_); }
+
+    const Node *Take() noexcept { return std::exchange(p_, nullptr); }
+
+   private:
+    const Node *p_;
+  };
+
+  static unsigned char Height(const Node *p) noexcept;
+  static const Node *Make(const T &data, const Node *left, const Node *right);
+  static const Node *Balance(const T &data, const Node *left,
+                             const Node *right);
+
+  const Node *FindNode(const Key &key) const noexcept;
+  const Node *InsertNode(const Node *p, const T &data) const;
+  const Node *RemoveNode(const Node *p, const Key &key) const;
+  static const Node *RemoveMin(const Node *p);
+  static const Node *FindMin(const Node *p) noexcept;
+  static const Node *FindMax(const Node *p) noexcept;
+  const Node *Next(const Node *p) const noexcept;
+  const Node *Prev(const Node *p) const noexcept;
+
+  const Node *root_ = nullptr;
+  size_type size_ = 0;
+
+  // It shows how to extract the key from the data
+  // and by default the data are itself the key.
+  key_extractor_type key_extractor_{
+      [](const T &data) -> const Key & { return data; }};
+};
+
+// Functions
+template <typename Key, typename T>
+PersistentTree<Key, T>::PersistentTree(key_extractor_type key_extractor)
+    : root_(nullptr), size_(0), key_extractor_{key_extractor} {}
+
+// copy constructor: shares all the nodes with the other tree
+template <typename Key, typename T>
+PersistentTree<Key, T>::PersistentTree(const PersistentTree &other) noexcept
+    : root_(Retain(other.root_)),
+      size_(other.size_),
+      key_extractor_(other.key_extractor_) {}
+
+// move constructor
+template <typename Key, typename T>
+PersistentTree<Key, T>::PersistentTree(PersistentTree &&other) noexcept {
+  swap(other);
+}
+
+template <typename Key, typename T>
+PersistentTree<Key, T>::~PersistentTree() {
+  Release(root_);
+}
+
+template <typename Key, typename T>
+PersistentTree<Key, T> &PersistentTree<Key, T>::operator=(
+    PersistentTree<Key, T> other) noexcept {
+  swap(other);
+  return *this;
+}
+
+template <typename Key, typename T>
+PersistentTree<Key, T> PersistentTree<Key, T>::snapshot() const noexcept {
+  return *this;
+}
+
+// Iterators
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::iterator PersistentTree<Key, T>::begin()
+    const noexcept {
+  return iterator(this, root_ ? FindMin(root_) : nullptr);
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::iterator PersistentTree<Key, T>::end()
+    const noexcept {
+  return iterator(this, nullptr);
+}
+
+// Capacity
+template <typename Key, typename T>
+bool PersistentTree<Key, T>::empty() const noexcept {
+  return root_ == nullptr;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::size_type PersistentTree<Key, T>::size()
+    const noexcept {
+  return size_;
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::size_type PersistentTree<Key, T>::max_size()
+    const noexcept {
+  return (~(size_type(0))) / sizeof(Node);
+}
+
+// Modifiers
+// Drops this version; nodes still shared with other versions survive.
+template <typename Key, typename T>
+void PersistentTree<Key, T>::clear() {
+  Release(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+// Inserts the value if its key is absent. Only O(log n) nodes on the
+// search path are copied, the rest is shared with the previous version.
+template <typename Key, typename T>
+std::pair<PersistentTreeIterator<Key, T>, bool> PersistentTree<Key, T>::insert(
+    const value_type &value) {
+  const Node *found = FindNode(key_extractor_(value));
+  if (found) return {iterator(this, found), false};
+
+  const Node *root = InsertNode(root_, value);
+  Release(root_);
+  root_ = root;
+  ++size_;
+  return {find(key_extractor_(value)), true};
+}
+
+// Inserts the value or replaces the one with the same key.
+template <typename Key, typename T>
+std::pair<PersistentTreeIterator<Key, T>, bool>
+PersistentTree<Key, T>::insert_or_assign(const value_type &value) {
+  bool inserted = !FindNode(key_extractor_(value));
+  const Node *root = InsertNode(root_, value);
+  Release(root_);
+  root_ = root;
+  if (inserted) ++size_;
+  return {find(key_extractor_(value)), inserted};
+}
+
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::size_type PersistentTree<Key, T>::erase(
+    const key_type &key) {
+  if (!FindNode(key)) return 0;
+  const Node *root = RemoveNode(root_, key);
+  Release(root_);
+  root_ = root;
+  --size_;
+  return 1;
+}
+
+template <typename Key, typename T>
+void PersistentTree<Key, T>::erase(iterator pos) {
+  erase(key_extractor_(pos.p_->data_));
+}
+
+template <typename Key, typename T>
+void PersistentTree<Key, T>::swap(PersistentTree<Key, T> &other) noexcept {
+  using std::swap;
+  swap(root_, other.root_);
+  swap(size_, other.size_);
+  swap(key_extractor_, other.key_extractor_);
+}
+
+// Lookup
+template <typename Key, typename T>
+typename PersistentTree<Key, T>::iterator PersistentTree<Key, T>::find(
+    const key_type &key) const noexcept {
+  return iterator(this, FindNode(key));
+}
+
+template <typename Key, typename T>
+bool PersistentTree<Key, T>::contains(const key_type &key) const noexcept {
+  return FindNode(key);
+}
+
+// Reference counting
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::Retain(
+    const Node *p) noexcept {
+  if (p) p->refs_.fetch_add(1, std::memory_order_relaxed);
+  return p;
+}
+
+// Frees the node when its last owner is gone and releases its children.
+// Only the nodes owned by nobody else are visited, so the walk is bounded
+// by the number of freed nodes and its depth by the tree height.
+template <typename Key, typename T>
+void PersistentTree<Key, T>::Release(const Node *p) noexcept {
+  if (p && p->refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    Release(p->left_);
+    Release(p->right_);
+    delete p;
+  }
+}
+
+template <typename Key, typename T>
+unsigned char PersistentTree<Key, T>::Height(const Node *p) noexcept {
+  return p ? p->height_ : 0;
+}
+
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::Make(const T &data,
+                                                      const Node *left,
+                                                      const Node *right) {
+  unsigned char hl = Height(left);
+  unsigned char hr = Height(right);
+  try {
+    return new Node(data, left, right, (hl > hr ? hl : hr) + 1);
+  } catch (...) {
+    Release(left);
+    Release(right);
+    throw;
+  }
+}
+
+// Builds a node from data and two subtrees whose heights differ by at
+// most 2. Rotations can't modify shared nodes, so they build new ones,
+// one at a time: a node made is owned until it is linked, so nothing
+// leaks if a later allocation throws.
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::Balance(const T &data,
+                                                         const Node *left,
+                                                         const Node *right) {
+  // the rotated child stays alive until its parts are retained
+  Owned l(left);
+  Owned r(right);
+  if (Height(left) > Height(right) + 1) {
+    const Node *ll = left->left_;
+    const Node *lr = left->right_;
+    if (Height(ll) >= Height(lr)) {
+      const Node *b = Make(data, Retain(lr), r.Take());
+      return Make(left->data_, Retain(ll), b);
+    }
+    Owned a(Make(left->data_, Retain(ll), Retain(lr->left_)));
+    const Node *b = Make(data, Retain(lr->right_), r.Take());
+    return Make(lr->data_, a.Take(), b);
+  }
+  if (Height(right) > Height(left) + 1) {
+    const Node *rl = right->left_;
+    const Node *rr = right->right_;
+    if (Height(rr) >= Height(rl)) {
+      const Node *a = Make(data, l.Take(), Retain(rl));
+      return Make(right->data_, a, Retain(rr));
+    }
+    Owned a(Make(data, l.Take(), Retain(rl->left_)));
+    const Node *b = Make(right->data_, Retain(rl->right_), Retain(rr));
+    return Make(rl->data_, a.Take(), b);
+  }
+  return Make(data, l.Take(), r.Take());
+}
+
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::FindNode(
+    const Key &key) const noexcept {
+  const Node *p = root_;
+  while (p) {
+    const Key &p_key = key_extractor_(p->data_);
+    if (key < p_key)
+      p = p->left_;
+    else if (p_key < key)
+      p = p->right_;
+    else
+      break;
+  }
+  return p;
+}
+
+// Returns a new version of the subtree p with data inserted
+// (or replaced if the key is already there).
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::InsertNode(
+    const Node *p, const T &data) const {
+  if (!p) return Make(data, nullptr, nullptr);
+  const Key &key = key_extractor_(data);
+  const Key &p_key = key_extractor_(p->data_);
+  if (key < p_key) {
+    const Node *left = InsertNode(p->left_, data);
+    return Balance(p->data_, left, Retain(p->right_));
+  }
+  if (p_key < key) {
+    const Node *right = InsertNode(p->right_, data);
+    return Balance(p->data_, Retain(p->left_), right);
+  }
+  return Make(data, Retain(p->left_), Retain(p->right_));
+}
+
+// Returns a new version of the subtree p without the key.
+// The key must be present in the subtree.
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::RemoveNode(
+    const Node *p, const Key &key) const {
+  const Key &p_key = key_extractor_(p->data_);
+  if (key < p_key) {
+    const Node *left = RemoveNode(p->left_, key);
+    return Balance(p->data_, left, Retain(p->right_));
+  }
+  if (p_key < key) {
+    const Node *right = RemoveNode(p->right_, key);
+    return Balance(p->data_, Retain(p->left_), right);
+  }
+  if (!p->right_) return Retain(p->left_);
+  const Node *min = FindMin(p->right_);
+  const Node *right = RemoveMin(p->right_);
+  return Balance(min->data_, Retain(p->left_), right);
+}
+
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::RemoveMin(const Node *p) {
+  if (!p->left_) return Retain(p->right_);
+  const Node *left = RemoveMin(p->left_);
+  return Balance(p->data_, left, Retain(p->right_));
+}
+
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::FindMin(
+    const Node *p) noexcept {
+  while (p->left_) p = p->left_;
+  return p;
+}
+
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::FindMax(
+    const Node *p) noexcept {
+  while (p->right_) p = p->right_;
+  return p;
+}
+
+// Nodes have no parent pointers (a node may have many parents in
+// different versions), so the successor is searched from the root.
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::Next(
+    const Node *p) const noexcept {
+  if (!p) return nullptr;
+  if (p->right_) return FindMin(p->right_);
+  const Node *w = nullptr;
+  const Node *q = root_;
+  const Key &key = key_extractor_(p->data_);
+  while (q != p) {
+    if (key < key_extractor_(q->data_)) {
+      w = q;
+      q = q->left_;
+    } else {
+      q = q->right_;
+    }
+  }
+  return w;
+}
+
+// Returns the previous node; for the end() iterator it's the last node.
+template <typename Key, typename T>
+const PersistentNode<T> *PersistentTree<Key, T>::Prev(
+    const Node *p) const noexcept {
+  if (!p) return root_ ? FindMax(root_) : nullptr;
+  if (p->left_) return FindMax(p->left_);
+  const Node *w = nullptr;
+  const Node *q = root_;
+  const Key &key = key_extractor_(p->data_);
+  while (q != p) {
+    if (key < key_extractor_(q->data_)) {
+      q = q->left_;
+    } else {
+      w = q;
+      q = q->right_;
+    }
+  }
+  return w;
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_PERSISTENT_TREE_H_  // NOLINT
@@ -0,0 +1,209 @@
+#ifndef S21_CONTAINERS_BLOOM_FILTER_BLOOM_FILTER_H_  // NOLINT
+#define S21_CONTAINERS_BLOOM_FILTER_BLOOM_FILTER_H_  // NOLINT
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif  // __AVX2__
+
+namespace s21 {
+
+// A blocked Bloom filter: a set that answers "maybe here" or "surely
+// not here" in a few bits per key. A key hashes to one block of 256
+// bits and sets one bit in each of its eight 32-bit words, so a lookup
+// reads a single block, aligned to never cross a cache line, instead of
+// k scattered bits. With AVX2 the eight bits are made and tested in one
+// vector; otherwise in a loop. Keys can't be erased.
+//
+// The number of blocks is chosen for the expected number of keys and
+// the false positive rate. The rate goes up once more keys than that
+// are inserted.
+template <typename Key, typename Hash = std::hash<Key>>
+class bloom_filter {
+ public:
+  // Member type
+  using key_type = Key;
+  using hasher = Hash;
+  using size_type = size_t;
+
+  // Functions
+  // Throws std::invalid_argument unless 0 < false_positive_rate < 1
+  explicit bloom_filter(size_type expected_items = 1024,
+                        double false_positive_rate = 0.01,
+                        const Hash &hash = Hash());
+
+  // Capacity
+  // The number of insertions, counting repeated keys
+  size_type size() const noexcept { return size_; }
+  // The number of keys the filter is made for
+  size_type capacity() const noexcept { return capacity_; }
+  size_type bit_count() const noexcept { return blocks_.size() * 256; }
+  double false_positive_rate() const noexcept { return rate_; }
+
+  // Modifiers
+  void insert(const Key &key) noexcept;
+  void clear() noexcept;
+  void swap(bloom_filter &other) noexcept;
+
+  // Lookup
+  // false if the key was never inserted; true if it was, and for a
+  // false_positive_rate() share of the other keys
+  bool may_contain(const Key &key) const noexcept;
+
+ private:
+  struct alignas(32) Block {
+    uint32_t words_[8];
+  };
+
+  // The false positive rate with lambda keys per block on average
+  static double BlockedRate(double lambda);
+  static size_type BlocksFor(size_type items, double rate);
+  // 64 bits of the hash: the high half picks the block, the low one the
+  // bits
+  uint64_t Mix(const Key &key) const noexcept;
+  size_type BlockIndex(uint64_t h) const noexcept {
+    return static_cast<size_type>(((h >> 32) * blocks_.size()) >> 32);
+  }
+
+  // The multipliers that spread a hash to the eight words
+  static constexpr uint32_t kSalt[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                        0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                        0x9efc4947U, 0x5c6bfb31U};
+
+  Hash hash_;
+  std::vector<Block> blocks_;
+  size_type size_ = 0;
+  size_type capacity_;
+  double rate_;
+};
+
+// Functions
+template <typename Key, typename Hash>
+bloom_filter<Key, Hash>::bloom_filter(size_type expected_items,
+                                      double false_positive_rate,
+                                      const Hash &hash)
+    : hash_(hash), capacity_(expected_items), rate_(false_positive_rate) {
+  if (!(false_positive_rate > 0 && false_positive_rate < 1)) {
+    throw std::invalid_argument("bloom_filter: rate must be in (0, 1)");
+  }
+  blocks_.resize(BlocksFor(expected_items, false_positive_rate), Block{});
+}
+
+// Modifiers
+template <typename Key, typename Hash>
+void bloom_filter<Key, Hash>::insert(const Key &key) noexcept {
+  uint64_t h = Mix(key);
+  Block &block = blocks_[BlockIndex(h)];
+  uint32_t bits = static_cast<uint32_t>(h);
+#ifdef __AVX2__
+  __m256i salt =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(kSalt));
+  __m256i shift = _mm256_srli_epi32(
+      _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(bits)), salt),
+      27);
+  __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), shift);
+  __m256i *words = reinterpret_cast<__m256i *>(block.words_);
+  _mm256_store_si256(words, _mm256_or_si256(_mm256_load_si256(words), mask));
+#else
+  for (int i = 0; i < 8; ++i)
+    block.words_[i] |= uint32_t(1) << ((bits * kSalt[i]) >> 27);
+#endif  // __AVX2__
+  ++size_;
+}
+
+template <typename Key, typename Hash>
+void bloom_filter<Key, Hash>::clear() noexcept {
+  for (Block &block : blocks_) block = Block{};
+  size_ = 0;
+}
+
+template <typename Key, typename Hash>
+void bloom_filter<Key, Hash>::swap(bloom_filter &other) noexcept {
+  std::swap(hash_, other.hash_);
+  blocks_.swap(other.blocks_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(rate_, other.rate_);
+}
+
+// Lookup
+template <typename Key, typename Hash>
+bool bloom_filter<Key, Hash>::may_contain(const Key &key) const noexcept {
+  uint64_t h = Mix(key);
+  const Block &block = blocks_[BlockIndex(h)];
+  uint32_t bits = static_cast<uint32_t>(h);
+#ifdef __AVX2__
+  __m256i salt =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(kSalt));
+  __m256i shift = _mm256_srli_epi32(
+      _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(bits)), salt),
+      27);
+  __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), shift);
+  return _mm256_testc_si256(
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(block.words_)),
+      mask);
+#else
+  uint32_t missing = 0;
+  for (int i = 0; i < 8; ++i)
+    missing |= ~block.words_[i] & (uint32_t(1) << ((bits * kSalt[i]) >> 27));
+  return !missing;
+#endif  // __AVX2__
+}
+
+// A block with j keys misses a bit of a word with the chance (31/32)^j;
+// the number of keys in a block is about Poisson(lambda)
+template <typename Key, typename Hash>
+double bloom_filter<Key, Hash>::BlockedRate(double lambda) {
+  double spread = 12 * std::sqrt(lambda) + 30;
+  double rate = 0;
+  double first = std::floor(std::fmax(0, lambda - spread));
+  for (double j = first; j <= lambda + spread; ++j) {
+    double poisson =
+        std::exp(j * std::log(lambda) - lambda - std::lgamma(j + 1));
+    rate += poisson * std::pow(1 - std::pow(31.0 / 32, j), 8);
+  }
+  return rate;
+}
+
+// The fewest blocks that keep the rate, by a binary search
+template <typename Key, typename Hash>
+typename bloom_filter<Key, Hash>::size_type
+bloom_filter<Key, Hash>::BlocksFor(size_type items, double rate) {
+  double n = static_cast<double>(items ? items : 1);
+  size_type lo = 1;
+  size_type hi = 1;
+  while (BlockedRate(n / static_cast<double>(hi)) > rate && hi < (1ULL << 40))
+    hi *= 2;
+  while (lo < hi) {
+    size_type mid = lo + (hi - lo) / 2;
+    if (BlockedRate(n / static_cast<double>(mid)) > rate)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+// The finalizer of MurmurHash3, as std::hash of an integer is often the
+// integer itself
+template <typename Key, typename Hash>
+uint64_t bloom_filter<Key, Hash>::Mix(const Key &key) const noexcept {
+  uint64_t h = static_cast<uint64_t>(hash_(key));
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_BLOOM_FILTER_BLOOM_FILTER_H_  // NOLINT
@@ -0,0 +1,341 @@
+#ifndef S21_CONTAINERS_CONCURRENT_STACK_CONCURRENT_STACK_H_  // NOLINT
+#define S21_CONTAINERS_CONCURRENT_STACK_CONCURRENT_STACK_H_  // NOLINT
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// A node pointer and a version counter packed into one word, so that
+// both can be compared and swapped with a single-width CAS. The counter
+// changes on every pop, which makes a CAS fail if the top was popped
+// and pushed again in between (the ABA problem). Pointers take the low
+// 48 bits on 64-bit platforms and the counter the other 16; on 32-bit
+// platforms both get 32 bits.
+//
+// 48 bits hold the usual user address space of x86-64 and AArch64, but
+// not one with 5-level paging (LA57) or pointers tagged in the top byte
+// (AArch64 TBI, MTE); Pack asserts that the high bits are free. A
+// 16-bit counter wraps after 65536 pops, so a thread stalled between
+// its load and its CAS for that many pops could still see ABA: beyond
+// that the guarantee is only probabilistic.
+class TaggedPointer {
+ public:
+  static constexpr int kPointerBits = sizeof(void *) == 8 ? 48 : 32;
+
+  static uint64_t Pack(void *p, uint64_t tag) noexcept {
+    uint64_t bits = reinterpret_cast<uintptr_t>(p);
+    assert((bits >> kPointerBits) == 0);
+    return bits | (tag << kPointerBits);
+  }
+  template <typename Node>
+  static Node *Pointer(uint64_t word) noexcept {
+    return reinterpret_cast<Node *>(
+        static_cast<uintptr_t>(word & ((uint64_t(1) << kPointerBits) - 1)));
+  }
+  static uint64_t Tag(uint64_t word) noexcept { return word >> kPointerBits; }
+};
+
+// A lock-free LIFO (a Treiber stack) for sharing work or free lists
+// between threads. All the members but the constructors and the
+// destructor may be called concurrently.
+//
+// The top is a TaggedPointer, so a CAS never succeeds on a stale top.
+// Popped nodes aren't freed but kept on an internal free list (itself a
+// Treiber stack) and reused by later pushes, so a thread that still
+// reads a node it lost the race for never touches freed memory. All the
+// nodes are freed by the destructor.
+//
+// With elimination slots, a push and a pop that both lose a CAS under
+// contention meet in a random slot and hand the element over directly,
+// without touching the top.
+template <typename T>
+class concurrent_stack {
+ public:
+  // types
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // constructors
+  concurrent_stack() = default;
+  // elimination_slots is the size of the elimination array (0 turns
+  // elimination off); a few slots per contending thread pair is enough.
+  explicit concurrent_stack(size_type elimination_slots);
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+  ~concurrent_stack();
+
+  // true if the stack was empty at the moment of the call
+  bool empty() const noexcept {
+    uint64_t top = top_.load(std::memory_order_acquire);
+    return TaggedPointer::Pointer<Node>(top) == nullptr;
+  }
+
+  // modifiers
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+  template <typename... Args>
+  void emplace(Args &&...args);
+
+  // Moves the top element to *value and returns true, or returns false
+  // if the stack is empty.
+  bool try_pop(value_type *value);
+
+  // Pushes [first, last) with a single CAS, so the elements land on the
+  // stack together and in order (the last one on top).
+  template <typename InputIt>
+  void push_list(InputIt first, InputIt last);
+
+  // Takes all the elements with a single exchange and moves them to
+  // out, top first. Returns the end of the output.
+  template <typename OutputIt>
+  OutputIt pop_all(OutputIt out);
+
+ private:
+  struct Node {
+    template <typename... Args>
+    void Construct(Args &&...args) {
+      ::new (static_cast<void *>(storage_)) T(std::forward<Args>(args)...);
+    }
+    T &Value() noexcept {
+      return *std::launder(reinterpret_cast<T *>(storage_));
+    }
+
+    alignas(T) unsigned char storage_[sizeof(T)];
+    // written by the owner and read by the threads racing for the node
+    std::atomic<Node *> next{nullptr};
+  };
+
+  // a node with a value constructed from args
+  template <typename... Args>
+  Node *MakeNode(Args &&...args);
+  // Destroys the value and puts the node on the free list
+  void Recycle(Node *node) noexcept;
+
+  // Pushes the chain first..last on head
+  static void PushChain(std::atomic<uint64_t> *head, Node *first,
+                        Node *last) noexcept;
+  // The top node of head, unlinked; nullptr if there is none. With
+  // elimination it also looks for an offered node after a failed CAS.
+  Node *PopNode(std::atomic<uint64_t> *head, bool eliminate);
+  static void DeleteChain(Node *node, bool with_values) noexcept;
+
+  // The elimination array of TaggedPointer words: a pusher offers its
+  // node in a slot for a while, a popper takes it.
+  bool TryEliminatePush(Node *node);
+  Node *TryEliminatePop();
+  std::atomic<uint64_t> *RandomSlot() noexcept;
+
+  static constexpr int kEliminationSpins = 128;
+
+  std::atomic<uint64_t> top_{0};
+  std::atomic<uint64_t> free_{0};
+  std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+  size_type n_slots_ = 0;
+};
+
+// definitions
+template <typename T>
+concurrent_stack<T>::concurrent_stack(size_type elimination_slots)
+    : slots_(elimination_slots
+                 ? new std::atomic<uint64_t>[elimination_slots]()
+                 : nullptr),
+      n_slots_(elimination_slots) {}
+
+template <typename T>
+concurrent_stack<T>::~concurrent_stack() {
+  DeleteChain(TaggedPointer::Pointer<Node>(top_.load()), true);
+  DeleteChain(TaggedPointer::Pointer<Node>(free_.load()), false);
+}
+
+template <typename T>
+template <typename... Args>
+void concurrent_stack<T>::emplace(Args &&...args) {
+  Node *node = MakeNode(std::forward<Args>(args)...);
+  if (!n_slots_) return PushChain(&top_, node, node);
+
+  uint64_t old = top_.load(std::memory_order_relaxed);
+  for (;;) {
+    node->next.store(TaggedPointer::Pointer<Node>(old),
+                     std::memory_order_relaxed);
+    if (top_.compare_exchange_weak(
+            old, TaggedPointer::Pack(node, TaggedPointer::Tag(old)),
+            std::memory_order_release, std::memory_order_relaxed))
+      return;
+    if (TryEliminatePush(node)) return;
+    old = top_.load(std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+bool concurrent_stack<T>::try_pop(value_type *value) {
+  Node *node = PopNode(&top_, n_slots_ != 0);
+  if (!node) return false;
+  *value = std::move(node->Value());
+  Recycle(node);
+  return true;
+}
+
+template <typename T>
+template <typename InputIt>
+void concurrent_stack<T>::push_list(InputIt first, InputIt last) {
+  Node *top = nullptr;
+  Node *bottom = nullptr;
+  try {
+    for (; first != last; ++first) {
+      Node *node = MakeNode(*first);
+      node->next.store(top, std::memory_order_relaxed);
+      top = node;
+      if (!bottom) bottom = node;
+    }
+  } catch (...) {
+    while (top) {
+      Node *next = top->next.load(std::memory_order_relaxed);
+      Recycle(top);
+      top = next;
+    }
+    throw;
+  }
+  if (top) PushChain(&top_, top, bottom);
+}
+
+template <typename T>
+template <typename OutputIt>
+OutputIt concurrent_stack<T>::pop_all(OutputIt out) {
+  // Nothing can race for the detached nodes, but the version has to
+  // change like on any pop
+  uint64_t old = top_.load(std::memory_order_relaxed);
+  while (!top_.compare_exchange_weak(
+      old, TaggedPointer::Pack(nullptr, TaggedPointer::Tag(old) + 1),
+      std::memory_order_acquire, std::memory_order_relaxed)) {
+  }
+  Node *node = TaggedPointer::Pointer<Node>(old);
+  while (node) {
+    Node *next = node->next.load(std::memory_order_relaxed);
+    *out = std::move(node->Value());
+    ++out;
+    Recycle(node);
+    node = next;
+  }
+  return out;
+}
+
+template <typename T>
+template <typename... Args>
+typename concurrent_stack<T>::Node *concurrent_stack<T>::MakeNode(
+    Args &&...args) {
+  Node *node = PopNode(&free_, false);
+  if (!node) node = new Node;
+  try {
+    node->Construct(std::forward<Args>(args)...);
+  } catch (...) {
+    PushChain(&free_, node, node);
+    throw;
+  }
+  return node;
+}
+
+template <typename T>
+void concurrent_stack<T>::Recycle(Node *node) noexcept {
+  node->Value().~T();
+  PushChain(&free_, node, node);
+}
+
+template <typename T>
+void concurrent_stack<T>::PushChain(std::atomic<uint64_t> *head, Node *first,
+                                    Node *last) noexcept {
+  uint64_t old = head->load(std::memory_order_relaxed);
+  do {
+    last->next.store(TaggedPointer::Pointer<Node>(old),
+                     std::memory_order_relaxed);
+  } while (!head->compare_exchange_weak(
+      old, TaggedPointer::Pack(first, TaggedPointer::Tag(old)),
+      std::memory_order_release, std::memory_order_relaxed));
+}
+
+// The node may be popped and reused by another thread right after the
+// load of the top; then its next is stale, but the version has changed
+// and the CAS fails.
+template <typename T>
+typename concurrent_stack<T>::Node *concurrent_stack<T>::PopNode(
+    std::atomic<uint64_t> *head, bool eliminate) {
+  uint64_t old = head->load(std::memory_order_acquire);
+  for (;;) {
+    Node *node = TaggedPointer::Pointer<Node>(old);
+    if (!node) return nullptr;
+    Node *next = node->next.load(std::memory_order_relaxed);
+    if (head->compare_exchange_weak(
+            old, TaggedPointer::Pack(next, TaggedPointer::Tag(old) + 1),
+            std::memory_order_acquire, std::memory_order_acquire))
+      return node;
+    if (eliminate && (node = TryEliminatePop())) return node;
+  }
+}
+
+template <typename T>
+void concurrent_stack<T>::DeleteChain(Node *node, bool with_values) noexcept {
+  while (node) {
+    Node *next = node->next.load(std::memory_order_relaxed);
+    if (with_values) node->Value().~T();
+    delete node;
+    node = next;
+  }
+}
+
+// Offers the node in a free slot for a while. Every change of a slot
+// bumps its version, so the pusher can take back exactly its own offer
+// with a CAS; if that fails, a popper has taken the node.
+template <typename T>
+bool concurrent_stack<T>::TryEliminatePush(Node *node) {
+  std::atomic<uint64_t> *slot = RandomSlot();
+  uint64_t old = slot->load(std::memory_order_relaxed);
+  if (TaggedPointer::Pointer<Node>(old)) return false;
+  uint64_t offer = TaggedPointer::Pack(node, TaggedPointer::Tag(old) + 1);
+  if (!slot->compare_exchange_strong(old, offer, std::memory_order_release,
+                                     std::memory_order_relaxed))
+    return false;
+  for (int i = 0; i < kEliminationSpins; ++i) {
+    if (slot->load(std::memory_order_relaxed) != offer) return true;
+  }
+  return !slot->compare_exchange_strong(
+      offer, TaggedPointer::Pack(nullptr, TaggedPointer::Tag(offer) + 1),
+      std::memory_order_relaxed, std::memory_order_relaxed);
+}
+
+template <typename T>
+typename concurrent_stack<T>::Node *concurrent_stack<T>::TryEliminatePop() {
+  std::atomic<uint64_t> *slot = RandomSlot();
+  for (int i = 0; i < kEliminationSpins; ++i) {
+    uint64_t offer = slot->load(std::memory_order_relaxed);
+    Node *node = TaggedPointer::Pointer<Node>(offer);
+    if (node &&
+        slot->compare_exchange_strong(
+            offer, TaggedPointer::Pack(nullptr, TaggedPointer::Tag(offer) + 1),
+            std::memory_order_acquire, std::memory_order_relaxed))
+      return node;
+  }
+  return nullptr;
+}
+
+// xorshift: each thread walks the slots in its own order
+template <typename T>
+std::atomic<uint64_t> *concurrent_stack<T>::RandomSlot() noexcept {
+  thread_local uint32_t state =
+      static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&state)) | 1;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return &slots_[state % n_slots_];
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_CONCURRENT_STACK_CONCURRENT_STACK_H_  // NOLINT
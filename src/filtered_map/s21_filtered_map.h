@@ -0,0 +1,144 @@
+#ifndef S21_CONTAINERS_FILTERED_MAP_FILTERED_MAP_H_  // NOLINT
+#define S21_CONTAINERS_FILTERED_MAP_FILTERED_MAP_H_  // NOLINT
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "bloom_filter/s21_bloom_filter.h"
+#include "map/s21_map.h"
+
+namespace s21 {
+
+// s21::map with a bloom_filter of its keys in front of the lookups: a
+// key the filter has never seen is reported absent without going down
+// the tree, which is most of the cost of a miss.
+//
+// Only the functions that keep the filter up to date are offered. An
+// erased key stays in the filter, so it may still cost a descent; the
+// filter is rebuilt from the keys, at twice their number, when the
+// insertions it has seen outgrow its capacity.
+template <typename K, typename T, typename Compare = std::less<K>,
+          typename Hash = std::hash<K>>
+class filtered_map {
+  using Map = map<K, T, Compare>;
+
+ public:
+  // Member type
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = typename Map::value_type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Map::iterator;
+  using const_iterator = typename Map::const_iterator;
+  using size_type = size_t;
+  using filter_type = bloom_filter<K, Hash>;
+
+  // Functions
+  // Throws std::invalid_argument unless 0 < false_positive_rate < 1
+  explicit filtered_map(double false_positive_rate = 0.01)
+      : filter_(kMinCapacity, false_positive_rate) {}
+  filtered_map(std::initializer_list<value_type> const &items)
+      : filtered_map() {
+    for (const value_type &item : items) insert(item);
+  }
+
+  // Element access
+  T &at(const K &key) {
+    iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("filtered_map::at");
+    }
+    return it->second;
+  }
+  const T &at(const K &key) const {
+    iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("filtered_map::at");
+    }
+    return it->second;
+  }
+  T &operator[](const K &key) { return try_emplace(key).first->second; }
+
+  // Iterators
+  iterator begin() const noexcept { return map_.begin(); }
+  iterator end() const noexcept { return map_.end(); }
+
+  // Capacity
+  bool empty() const noexcept { return map_.empty(); }
+  size_type size() const noexcept { return map_.size(); }
+  size_type max_size() const noexcept { return map_.max_size(); }
+
+  // Modifiers
+  void clear() {
+    map_.clear();
+    filter_type(kMinCapacity, filter_.false_positive_rate()).swap(filter_);
+  }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    Reserve();
+    return Added(map_.insert(value));
+  }
+  std::pair<iterator, bool> insert(const K &key, const T &obj) {
+    return try_emplace(key, obj);
+  }
+  std::pair<iterator, bool> insert_or_assign(const K &key, const T &obj) {
+    Reserve();
+    return Added(map_.insert_or_assign(key, obj));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const K &key, Args &&...args) {
+    Reserve();
+    return Added(map_.try_emplace(key, std::forward<Args>(args)...));
+  }
+  void erase(iterator pos) { map_.erase(pos); }
+  size_type erase(const K &key) {
+    return filter_.may_contain(key) ? map_.erase(key) : 0;
+  }
+  void swap(filtered_map &other) noexcept {
+    map_.swap(other.map_);
+    filter_.swap(other.filter_);
+  }
+
+  // Lookup
+  size_type count(const K &key) const noexcept { return contains(key); }
+  iterator find(const K &key) const noexcept {
+    return filter_.may_contain(key) ? map_.find(key) : map_.end();
+  }
+  bool contains(const K &key) const noexcept {
+    return filter_.may_contain(key) && map_.contains(key);
+  }
+  iterator lower_bound(const K &key) const noexcept {
+    return map_.lower_bound(key);
+  }
+  iterator upper_bound(const K &key) const noexcept {
+    return map_.upper_bound(key);
+  }
+  const filter_type &filter() const noexcept { return filter_; }
+
+ private:
+  static constexpr size_type kMinCapacity = 64;
+
+  // Makes room in the filter for one more key before the map changes,
+  // so that a failed rebuild leaves both as they were
+  void Reserve() {
+    if (filter_.size() < filter_.capacity()) return;
+    filter_type filter(std::max(kMinCapacity, 2 * (map_.size() + 1)),
+                       filter_.false_positive_rate());
+    for (const value_type &item : map_) filter.insert(item.first);
+    filter_.swap(filter);
+  }
+  std::pair<iterator, bool> Added(std::pair<iterator, bool> res) noexcept {
+    if (res.second) filter_.insert(res.first->first);
+    return res;
+  }
+
+  Map map_;
+  filter_type filter_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_FILTERED_MAP_FILTERED_MAP_H_  // NOLINT
@@ -0,0 +1,295 @@
+#ifndef S21_CONTAINERS_INTRUSIVE_LIST_INTRUSIVE_LIST_H_  // NOLINT
+#define S21_CONTAINERS_INTRUSIVE_LIST_INTRUSIVE_LIST_H_  // NOLINT
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+class intrusive_list_hook;
+
+template <typename Obj, intrusive_list_hook Obj::*Member>
+class intrusive_list;
+
+// The links of an object in an intrusive_list. An object has one hook
+// member per list it can be in at a time. Copying an object doesn't
+// copy its membership: the copy of a hook is unlinked.
+class intrusive_list_hook {
+ public:
+  intrusive_list_hook() noexcept = default;
+  intrusive_list_hook(const intrusive_list_hook &) noexcept {}
+  intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept {
+    return *this;
+  }
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+ private:
+  intrusive_list_hook *prev_ = nullptr;
+  intrusive_list_hook *next_ = nullptr;
+  // the object the hook is a member of
+  void *owner_ = nullptr;
+
+  template <typename Obj, intrusive_list_hook Obj::*Member>
+  friend class intrusive_list;
+};
+
+// A doubly linked list of objects that carry the links themselves, in
+// an intrusive_list_hook member:
+//
+//   struct Task {
+//     s21::intrusive_list_hook in_queue;
+//   };
+//   s21::intrusive_list<Task, &Task::in_queue> queue;
+//
+// The list neither allocates nor copies: it links the objects the
+// caller owns, so they must outlive their membership (or be erased
+// first). Removal given the object is O(1). An object can be in as many
+// lists at once as it has hooks. Inserting an object that is already
+// linked by the hook throws std::invalid_argument.
+template <typename Obj, intrusive_list_hook Obj::*Member>
+class intrusive_list {
+ public:
+  // member types
+  using value_type = Obj;
+  using reference = Obj &;
+  using const_reference = const Obj &;
+  using size_type = std::size_t;
+
+  template <bool Const>
+  class IntrusiveListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Obj;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const Obj *, Obj *>;
+    using reference = std::conditional_t<Const, const Obj &, Obj &>;
+
+    IntrusiveListIterator() = default;
+    // iterator converts to const_iterator
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    IntrusiveListIterator(const IntrusiveListIterator<false> &other)  // NOLINT
+        : hook_(other.hook_) {}
+
+    reference operator*() const { return *Owner(hook_); }
+    pointer operator->() const { return Owner(hook_); }
+
+    IntrusiveListIterator &operator++() {
+      hook_ = hook_->next_;
+      return *this;
+    }
+    IntrusiveListIterator operator++(int) {
+      IntrusiveListIterator tmp = *this;
+      hook_ = hook_->next_;
+      return tmp;
+    }
+    IntrusiveListIterator &operator--() {
+      hook_ = hook_->prev_;
+      return *this;
+    }
+    IntrusiveListIterator operator--(int) {
+      IntrusiveListIterator tmp = *this;
+      hook_ = hook_->prev_;
+      return tmp;
+    }
+
+    bool operator==(const IntrusiveListIterator &rhs) const {
+      return hook_ == rhs.hook_;
+    }
+    bool operator!=(const IntrusiveListIterator &rhs) const {
+      return hook_ != rhs.hook_;
+    }
+
+   private:
+    explicit IntrusiveListIterator(intrusive_list_hook *hook) : hook_(hook) {}
+
+    intrusive_list_hook *hook_ = nullptr;
+    friend class intrusive_list;
+    template <bool>
+    friend class IntrusiveListIterator;
+  };
+
+  using iterator = IntrusiveListIterator<false>;
+  using const_iterator = IntrusiveListIterator<true>;
+
+  // constructors
+  intrusive_list() noexcept { Reset(); }
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list(intrusive_list &&other) noexcept : intrusive_list() {
+    swap(other);
+  }
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&other) noexcept;
+  // Unlinks the objects
+  ~intrusive_list() { clear(); }
+
+  // element access
+  reference front() { return *begin(); }
+  const_reference front() const { return *begin(); }
+  reference back() { return *--end(); }
+  const_reference back() const { return *--end(); }
+
+  // iterators
+  iterator begin() noexcept { return iterator(head_.next_); }
+  const_iterator begin() const noexcept { return const_iterator(head_.next_); }
+  iterator end() noexcept { return iterator(&head_); }
+  const_iterator end() const noexcept {
+    return const_iterator(const_cast<intrusive_list_hook *>(&head_));
+  }
+  // The iterator to an object in the list
+  iterator iterator_to(reference obj) noexcept {
+    return iterator(&(obj.*Member));
+  }
+  const_iterator iterator_to(const_reference obj) const noexcept {
+    return const_iterator(const_cast<intrusive_list_hook *>(&(obj.*Member)));
+  }
+
+  // capacity
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  // modifiers
+  void clear() noexcept;
+  // Links obj before pos
+  iterator insert(const_iterator pos, reference obj);
+  // Unlinks the object at pos and returns the iterator to the next one
+  iterator erase(const_iterator pos) noexcept;
+  // Unlinks obj, which must be in this list
+  void erase(reference obj) noexcept { erase(iterator_to(obj)); }
+  void push_back(reference obj) { insert(end(), obj); }
+  void pop_back();
+  void push_front(reference obj) { insert(begin(), obj); }
+  void pop_front();
+  void swap(intrusive_list &other) noexcept;
+  void reverse() noexcept;
+  // Moves the objects of other before pos
+  void splice(const_iterator pos, intrusive_list &other) noexcept;
+
+ private:
+  static Obj *Owner(intrusive_list_hook *hook) noexcept {
+    return static_cast<Obj *>(hook->owner_);
+  }
+  void Reset() noexcept { head_.prev_ = head_.next_ = &head_; }
+
+  // the sentinel: its next_ is the first hook, prev_ the last
+  intrusive_list_hook head_;
+  size_type size_ = 0;
+};
+
+template <typename Obj, intrusive_list_hook Obj::*Member>
+intrusive_list<Obj, Member> &intrusive_list<Obj, Member>::operator=(
+    intrusive_list &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename Obj, intrusive_list_hook Obj::*Member>
+void intrusive_list<Obj, Member>::clear() noexcept {
+  for (intrusive_list_hook *hook = head_.next_; hook != &head_;) {
+    intrusive_list_hook *next = hook->next_;
+    hook->prev_ = hook->next_ = nullptr;
+    hook->owner_ = nullptr;
+    hook = next;
+  }
+  Reset();
+  size_ = 0;
+}
+
+template <typename Obj, intrusive_list_hook Obj::*Member>
+typename intrusive_list<Obj, Member>::iterator
+intrusive_list<Obj, Member>::insert(const_iterator pos, reference obj) {
+  intrusive_list_hook *hook = &(obj.*Member);
+  if (hook->is_linked()) {
+    throw std::invalid_argument("The object is already in a list");
+  }
+  intrusive_list_hook *next = pos.hook_;
+  hook->owner_ = &obj;
+  hook->prev_ = next->prev_;
+  hook->next_ = next;
+  next->prev_->next_ = hook;
+  next->prev_ = hook;
+  ++size_;
+  return iterator(hook);
+}
+
+template <typename Obj, intrusive_list_hook Obj::*Member>
+typename intrusive_list<Obj, Member>::iterator
+intrusive_list<Obj, Member>::erase(const_iterator pos) noexcept {
+  intrusive_list_hook *hook = pos.hook_;
+  intrusive_list_hook *next = hook->next_;
+  hook->prev_->next_ = next;
+  next->prev_ = hook->prev_;
+  hook->prev_ = hook->next_ = nullptr;
+  hook->owner_ = nullptr;
+  --size_;
+  return iterator(next);
+}
+
+template <typename Obj, intrusive_list_hook Obj::*Member>
+void intrusive_list<Obj, Member>::pop_back() {
+  if (empty()) {
+    throw std::logic_error("List size is 0");
+  }
+  erase(--end());
+}
+
+template <typename Obj, intrusive_list_hook Obj::*Member>
+void intrusive_list<Obj, Member>::pop_front() {
+  if (empty()) {
+    throw std::logic_error("List size is 0");
+  }
+  erase(begin());
+}
+
+// The end hooks point to the sentinel, so they are fixed up
+template <typename Obj, intrusive_list_hook Obj::*Member>
+void intrusive_list<Obj, Member>::swap(intrusive_list &other) noexcept {
+  auto relink = [](intrusive_list_hook *head, intrusive_list_hook *old_head) {
+    if (head->next_ == old_head) {
+      head->prev_ = head->next_ = head;
+    } else {
+      head->next_->prev_ = head;
+      head->prev_->next_ = head;
+    }
+  };
+  std::swap(head_.prev_, other.head_.prev_);
+  std::swap(head_.next_, other.head_.next_);
+  relink(&head_, &other.head_);
+  relink(&other.head_, &head_);
+  std::swap(size_, other.size_);
+}
+
+template <typename Obj, intrusive_list_hook Obj::*Member>
+void intrusive_list<Obj, Member>::reverse() noexcept {
+  intrusive_list_hook *hook = &head_;
+  do {
+    std::swap(hook->prev_, hook->next_);
+    hook = hook->prev_;
+  } while (hook != &head_);
+}
+
+template <typename Obj, intrusive_list_hook Obj::*Member>
+void intrusive_list<Obj, Member>::splice(const_iterator pos,
+                                         intrusive_list &other) noexcept {
+  if (other.empty() || this == &other) return;
+  intrusive_list_hook *next = pos.hook_;
+  intrusive_list_hook *first = other.head_.next_;
+  intrusive_list_hook *last = other.head_.prev_;
+  first->prev_ = next->prev_;
+  next->prev_->next_ = first;
+  last->next_ = next;
+  next->prev_ = last;
+  size_ += other.size_;
+  other.Reset();
+  other.size_ = 0;
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_INTRUSIVE_LIST_INTRUSIVE_LIST_H_  // NOLINT
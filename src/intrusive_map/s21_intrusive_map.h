@@ -0,0 +1,50 @@
+#ifndef S21_CONTAINERS_INTRUSIVE_MAP_INTRUSIVE_MAP_H_  // NOLINT
+#define S21_CONTAINERS_INTRUSIVE_MAP_INTRUSIVE_MAP_H_  // NOLINT
+
+#include <functional>
+#include <stdexcept>
+
+#include "intrusive_set/s21_intrusive_set.h"
+
+namespace s21 {
+
+// The key of an intrusive_map is a data member of the object
+template <typename K, typename Obj, K Obj::*Key>
+struct IntrusiveMemberKey {
+  static const K &Get(Obj *const &obj) { return obj->*Key; }
+};
+
+// A map from the Key member of the objects to the objects, linked
+// through their intrusive_set_hook member:
+//
+//   struct Task {
+//     int id;
+//     s21::intrusive_set_hook<Task> by_id;
+//   };
+//   s21::intrusive_map<int, Task, &Task::id, &Task::by_id> tasks;
+template <typename K, typename Obj, K Obj::*Key,
+          intrusive_set_hook<Obj> Obj::*Member,
+          typename Compare = std::less<K>>
+class intrusive_map
+    : public IntrusiveTree<K, Obj, IntrusiveMemberKey<K, Obj, Key>, Member,
+                           Compare> {
+  using Base =
+      IntrusiveTree<K, Obj, IntrusiveMemberKey<K, Obj, Key>, Member, Compare>;
+
+ public:
+  using mapped_type = Obj;
+  using Base::Base;
+
+  // The object with the key; throws std::out_of_range if there is none
+  Obj &at(const K &key) const {
+    auto it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("intrusive_map::at");
+    }
+    return *it;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_INTRUSIVE_MAP_INTRUSIVE_MAP_H_  // NOLINT
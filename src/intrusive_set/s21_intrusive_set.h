@@ -0,0 +1,295 @@
+#ifndef S21_CONTAINERS_INTRUSIVE_SET_INTRUSIVE_SET_H_  // NOLINT
+#define S21_CONTAINERS_INTRUSIVE_SET_INTRUSIVE_SET_H_  // NOLINT
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "binary_tree/avl_tree_operations.h"
+
+namespace s21 {
+
+template <typename Obj>
+class intrusive_set_hook;
+
+template <typename Key, typename Obj, typename KeyOf,
+          intrusive_set_hook<Obj> Obj::*Member, typename Compare>
+class IntrusiveTree;
+
+// The links of an object in an intrusive_set or intrusive_map: an AVL
+// tree node whose data is the pointer to the object, so the trees reuse
+// AvlTreeOperations as they are. An object has one hook member per tree
+// it can be in at a time; the copy of a hook is unlinked.
+template <typename Obj>
+class intrusive_set_hook {
+ public:
+  intrusive_set_hook() noexcept : node_(nullptr) {}
+  intrusive_set_hook(const intrusive_set_hook &) noexcept
+      : intrusive_set_hook() {}
+  intrusive_set_hook &operator=(const intrusive_set_hook &) noexcept {
+    return *this;
+  }
+
+  bool is_linked() const noexcept { return node_.data_ != nullptr; }
+
+ private:
+  Node<Obj *> node_;
+
+  template <typename Key, typename O, typename KeyOf,
+            intrusive_set_hook<O> O::*Member, typename Compare>
+  friend class IntrusiveTree;
+};
+
+// The key of an intrusive_set is the object itself
+template <typename Obj>
+struct IntrusiveSelfKey {
+  static const Obj &Get(Obj *const &obj) { return *obj; }
+};
+
+// An ordered tree of objects that carry the tree links in a hook member
+// (see intrusive_set and intrusive_map). Insertion and erasure allocate
+// nothing and take O(log n); iterators go to the next object in
+// O(log n) like the iterators of BinaryTree, as the nodes have no
+// parent links.
+//
+// The tree doesn't own the objects: they must outlive their membership
+// or be erased first, and their keys must not change while they are
+// linked. The keys are unique, an object with a key that is already in
+// the tree isn't linked.
+template <typename Key, typename Obj, typename KeyOf,
+          intrusive_set_hook<Obj> Obj::*Member, typename Compare>
+class IntrusiveTree {
+  using TreeNode = Node<Obj *>;
+
+ public:
+  // member types
+  using key_type = Key;
+  using value_type = Obj;
+  using reference = Obj &;
+  using const_reference = const Obj &;
+  using size_type = std::size_t;
+
+  class iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Obj;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Obj *;
+    using reference = Obj &;
+
+    iterator() = default;
+
+    reference operator*() const { return *p_->data_; }
+    pointer operator->() const { return p_->data_; }
+
+    iterator &operator++() {
+      p_ = owner_->ops_.Next(owner_->root_, p_);
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    iterator &operator--() {
+      p_ = owner_->ops_.Prev(owner_->root_, p_);
+      return *this;
+    }
+    iterator operator--(int) {
+      iterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const iterator &rhs) const { return p_ == rhs.p_; }
+    bool operator!=(const iterator &rhs) const { return p_ != rhs.p_; }
+
+   private:
+    iterator(const IntrusiveTree *owner, TreeNode *p) : owner_(owner), p_(p) {}
+
+    const IntrusiveTree *owner_ = nullptr;
+    // nullptr is the end
+    TreeNode *p_ = nullptr;
+    friend class IntrusiveTree;
+  };
+
+  // constructors
+  explicit IntrusiveTree(const Compare &comp = Compare())
+      : ops_(&KeyOf::Get, comp) {}
+  IntrusiveTree(const IntrusiveTree &) = delete;
+  IntrusiveTree(IntrusiveTree &&other) noexcept : ops_(other.ops_) {
+    swap(other);
+  }
+  IntrusiveTree &operator=(const IntrusiveTree &) = delete;
+  IntrusiveTree &operator=(IntrusiveTree &&other) noexcept;
+  // Unlinks the objects
+  ~IntrusiveTree() { clear(); }
+
+  // iterators
+  iterator begin() const noexcept {
+    return iterator(this, root_ ? ops_.FindMin(root_) : nullptr);
+  }
+  iterator end() const noexcept { return iterator(this, nullptr); }
+  // The iterator to an object in the tree
+  iterator iterator_to(reference obj) const noexcept {
+    return iterator(this, &(obj.*Member).node_);
+  }
+
+  // capacity
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  // modifiers
+  void clear() noexcept;
+  // Links obj unless an object with its key is there already; the
+  // iterator points to the object with the key in either case
+  std::pair<iterator, bool> insert(reference obj);
+  // Unlinks the object at pos (iterator_to(obj) for an object in the
+  // tree)
+  void erase(iterator pos) noexcept;
+  // Unlinks the object with the key, if there is one
+  size_type erase(const key_type &key) noexcept;
+  void swap(IntrusiveTree &other) noexcept;
+
+  // lookup
+  iterator find(const key_type &key) const noexcept {
+    return iterator(this, ops_.Find(root_, key));
+  }
+  bool contains(const key_type &key) const noexcept {
+    return ops_.Find(root_, key) != nullptr;
+  }
+  size_type count(const key_type &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+  iterator lower_bound(const key_type &key) const noexcept {
+    return iterator(this, ops_.LowerBound(root_, key));
+  }
+  iterator upper_bound(const key_type &key) const noexcept {
+    return iterator(this, ops_.UpperBound(root_, key));
+  }
+
+ private:
+  static TreeNode *NodeOf(reference obj) noexcept {
+    return &(obj.*Member).node_;
+  }
+  // Makes the node of an unlinked hook
+  static void Unlink(TreeNode *node) noexcept {
+    node->left_ = node->right_ = nullptr;
+    node->height_ = 1;
+    node->data_ = nullptr;
+  }
+
+  AvlTreeOperations<Key, Obj *, Compare> ops_;
+  TreeNode *root_ = nullptr;
+  size_type size_ = 0;
+};
+
+template <typename Key, typename Obj, typename KeyOf,
+          intrusive_set_hook<Obj> Obj::*Member, typename Compare>
+IntrusiveTree<Key, Obj, KeyOf, Member, Compare> &
+IntrusiveTree<Key, Obj, KeyOf, Member, Compare>::operator=(
+    IntrusiveTree &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+// Rotates left children up until the node has none, like
+// AvlTreeOperations::Clear, but unlinks the nodes instead of deleting
+template <typename Key, typename Obj, typename KeyOf,
+          intrusive_set_hook<Obj> Obj::*Member, typename Compare>
+void IntrusiveTree<Key, Obj, KeyOf, Member, Compare>::clear() noexcept {
+  TreeNode *p = root_;
+  while (p) {
+    if (p->left_) {
+      TreeNode *l = p->left_;
+      p->left_ = l->right_;
+      l->right_ = p;
+      p = l;
+    } else {
+      TreeNode *r = p->right_;
+      Unlink(p);
+      p = r;
+    }
+  }
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename Key, typename Obj, typename KeyOf,
+          intrusive_set_hook<Obj> Obj::*Member, typename Compare>
+std::pair<typename IntrusiveTree<Key, Obj, KeyOf, Member, Compare>::iterator,
+          bool>
+IntrusiveTree<Key, Obj, KeyOf, Member, Compare>::insert(reference obj) {
+  TreeNode *node = NodeOf(obj);
+  if (node->data_) {
+    throw std::invalid_argument("The object is already in a tree");
+  }
+  typename AvlTreeOperations<Key, Obj *, Compare>::Position pos;
+  TreeNode *found = ops_.FindPosition(root_, KeyOf::Get(&obj), &pos);
+  if (found) return {iterator(this, found), false};
+  node->data_ = &obj;
+  root_ = ops_.InsertAt(&pos, node);
+  ++size_;
+  return {iterator(this, node), true};
+}
+
+template <typename Key, typename Obj, typename KeyOf,
+          intrusive_set_hook<Obj> Obj::*Member, typename Compare>
+void IntrusiveTree<Key, Obj, KeyOf, Member, Compare>::erase(
+    iterator pos) noexcept {
+  TreeNode *node = pos.p_;
+  root_ = ops_.ExtractNode(root_, node);
+  Unlink(node);
+  --size_;
+}
+
+template <typename Key, typename Obj, typename KeyOf,
+          intrusive_set_hook<Obj> Obj::*Member, typename Compare>
+typename IntrusiveTree<Key, Obj, KeyOf, Member, Compare>::size_type
+IntrusiveTree<Key, Obj, KeyOf, Member, Compare>::erase(
+    const key_type &key) noexcept {
+  TreeNode *node = ops_.Find(root_, key);
+  if (!node) return 0;
+  erase(iterator(this, node));
+  return 1;
+}
+
+template <typename Key, typename Obj, typename KeyOf,
+          intrusive_set_hook<Obj> Obj::*Member, typename Compare>
+void IntrusiveTree<Key, Obj, KeyOf, Member, Compare>::swap(
+    IntrusiveTree &other) noexcept {
+  std::swap(ops_, other.ops_);
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+}
+
+// A set of objects ordered by Compare, linked through their
+// intrusive_set_hook member:
+//
+//   struct Task {
+//     int id;
+//     s21::intrusive_set_hook<Task> by_id;
+//     bool operator<(const Task &other) const { return id < other.id; }
+//   };
+//   s21::intrusive_set<Task, &Task::by_id> tasks;
+//
+// Lookups take an object to compare with (a probe with the key fields
+// set is enough).
+template <typename Obj, intrusive_set_hook<Obj> Obj::*Member,
+          typename Compare = std::less<Obj>>
+class intrusive_set
+    : public IntrusiveTree<Obj, Obj, IntrusiveSelfKey<Obj>, Member, Compare> {
+  using Base = IntrusiveTree<Obj, Obj, IntrusiveSelfKey<Obj>, Member, Compare>;
+
+ public:
+  using Base::Base;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_INTRUSIVE_SET_INTRUSIVE_SET_H_  // NOLINT
@@ -1,6 +1,7 @@
 #ifndef S21_CONTAINERS_LIST_LIST_H_  // NOLINT
 #define S21_CONTAINERS_LIST_LIST_H_  // NOLINT
 
+#include <functional>
 #include <iostream>
 #include <limits>
 
@@ -36,13 +37,13 @@ class list {
   list& operator=(list&& l);
 
   // List Element access
-  const_reference front();
-  const_reference back();
+  const_reference front() const;
+  const_reference back() const;
 
   // Capacity
-  bool empty();
-  size_type size();
-  size_type max_size();
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
 
   // Modifiers
   void clear();
@@ -52,7 +53,12 @@ class list {
   void pop_front();
   void swap(list& other);
   void reverse();
-  void merge(list& other);
+  // Both lists must be sorted; relinks the nodes of other into this
+  // list in one pass, keeping the order of equal elements (the ones of
+  // this list first)
+  void merge(list& other) { merge(other, std::less<value_type>()); }
+  template <typename Compare>
+  void merge(list& other, Compare comp);
   void unique();
   void sort();
 
@@ -117,6 +123,13 @@ class list {
   iterator insert(iterator pos, const_reference value);
   void erase(iterator pos);
   void splice(const_iterator pos, list& other);  // NOLINT
+  // Moves the element at it of other (which may be this list) before
+  // pos, without copying
+  void splice(const_iterator pos, list& other, const_iterator it);  // NOLINT
+  // Moves [first, last) of other before pos, which must not be in the
+  // range; O(1) within one list and O(last - first) between two
+  void splice(const_iterator pos, list& other,  // NOLINT
+              const_iterator first, const_iterator last);
 
   // Bonus
   template <typename... Args>
@@ -133,6 +146,16 @@ class list {
   void add_end();
   void merge_sort(Node** list);
   Node* merge(Node* left, Node* right);
+  // Merges the sorted chains starting at a and b and ending before
+  // a_end and b_end. Returns the first node and puts the last one to
+  // *last; the last node's p_next_ is left as it was.
+  template <typename Compare>
+  static Node* merge_chains(Node* a, Node* a_end, Node* b, Node* b_end,
+                            Node** last, Compare comp);
+  // Unlinks the count nodes [first, last) of other and links them
+  // before pos
+  void transfer(Node* pos, list& other, Node* first, Node* last,
+                size_type count);
 
   Node* p_head_;
   Node* p_tail_;
@@ -224,28 +247,28 @@ typename list<value_type>::iterator list<value_type>::end() {
 }
 
 template <typename value_type>
-typename list<value_type>::const_reference list<value_type>::front() {
+typename list<value_type>::const_reference list<value_type>::front() const {
   return p_head_->val_;
 }
 
 template <typename value_type>
-typename list<value_type>::const_reference list<value_type>::back() {
+typename list<value_type>::const_reference list<value_type>::back() const {
   return p_tail_->val_;
 }
 
 // List sizes
 template <typename value_type>
-bool list<value_type>::empty() {
+bool list<value_type>::empty() const {
   return size_ == 0;
 }
 
 template <typename value_type>
-typename list<value_type>::size_type list<value_type>::size() {
+typename list<value_type>::size_type list<value_type>::size() const {
   return size_;
 }
 
 template <typename value_type>
-typename list<value_type>::size_type list<value_type>::max_size() {
+typename list<value_type>::size_type list<value_type>::max_size() const {
   return (std::numeric_limits<size_t>::max() / 2) / sizeof(Node);
 }
 
@@ -391,9 +414,24 @@ void list<value_type>::reverse() {
 }
 
 template <typename value_type>
-void list<value_type>::merge(list& other) {  // NOLINT
-  splice(end(), other);
-  sort();
+template <typename Compare>
+void list<value_type>::merge(list& other, Compare comp) {  // NOLINT
+  if (this == &other || other.empty()) return;
+  if (empty()) {
+    splice(end(), other);
+    return;
+  }
+  Node* last = nullptr;
+  p_head_ = merge_chains(p_head_, p_end_, other.p_head_, other.p_end_, &last,
+                         comp);
+  // the tail of the list whose nodes ran out later stays the tail
+  if (last == other.p_tail_) p_tail_ = last;
+  size_ += other.size_;
+  other.p_head_ = nullptr;
+  other.p_tail_ = nullptr;
+  other.size_ = 0;
+  other.add_end();
+  add_end();
 }
 
 template <typename value_type>
@@ -445,8 +483,91 @@ void list<value_type>::splice(const_iterator pos, list& other) {  // NOLINT
   }
 }
 
+template <typename value_type>
+void list<value_type>::splice(const_iterator pos, list& other,  // NOLINT
+                              const_iterator it) {
+  Node* next = it.ptr_->p_next_;
+  if (pos.ptr_ == it.ptr_ || pos.ptr_ == next) return;
+  transfer(pos.ptr_, other, it.ptr_, next, 1);
+}
+
+template <typename value_type>
+void list<value_type>::splice(const_iterator pos, list& other,  // NOLINT
+                              const_iterator first, const_iterator last) {
+  if (first == last) return;
+  size_type count = 0;
+  if (this != &other) {
+    for (Node* p = first.ptr_; p != last.ptr_; p = p->p_next_) ++count;
+  }
+  transfer(pos.ptr_, other, first.ptr_, last.ptr_, count);
+}
+
 // support funcs
 
+template <typename value_type>
+void list<value_type>::transfer(Node* pos, list& other, Node* first,
+                                Node* last, size_type count) {
+  Node* back = last->p_prev_;
+  Node* before = first->p_prev_;
+  before->p_next_ = last;
+  last->p_prev_ = before;
+  if (first == other.p_head_)
+    other.p_head_ = last == other.p_end_ ? nullptr : last;
+  if (back == other.p_tail_)
+    other.p_tail_ = before == other.p_end_ ? nullptr : before;
+  other.size_ -= count;
+  other.add_end();
+
+  if (!p_head_) {
+    p_head_ = first;
+    p_tail_ = back;
+  } else {
+    Node* prev = pos->p_prev_;
+    prev->p_next_ = first;
+    first->p_prev_ = prev;
+    back->p_next_ = pos;
+    pos->p_prev_ = back;
+    if (pos == p_head_) p_head_ = first;
+    if (pos == p_end_) p_tail_ = back;
+  }
+  size_ += count;
+  add_end();
+}
+
+template <typename value_type>
+template <typename Compare>
+typename list<value_type>::Node* list<value_type>::merge_chains(
+    Node* a, Node* a_end, Node* b, Node* b_end, Node** last, Compare comp) {
+  Node* head = nullptr;
+  Node* tail = nullptr;
+  auto append = [&head, &tail](Node* p) {
+    if (tail)
+      tail->p_next_ = p;
+    else
+      head = p;
+    p->p_prev_ = tail;
+    tail = p;
+  };
+  while (a != a_end && b != b_end) {
+    // an element of b goes first only if it is strictly less
+    if (comp(b->val_, a->val_)) {
+      append(b);
+      b = b->p_next_;
+    } else {
+      append(a);
+      a = a->p_next_;
+    }
+  }
+  Node* rest = a != a_end ? a : b;
+  Node* rest_end = a != a_end ? a_end : b_end;
+  if (rest != rest_end) {
+    append(rest);
+    while (tail->p_next_ != rest_end) tail = tail->p_next_;
+  }
+  *last = tail;
+  return head;
+}
+
 template <typename value_type>
 void list<value_type>::add_end() {
   if (p_end_) {
@@ -465,25 +586,10 @@ void list<value_type>::add_end() {
 template <typename value_type>
 typename list<value_type>::Node* list<value_type>::merge(Node* left,
                                                          Node* right) {
-  if (left == nullptr) {
-    return right;
-  }
-  if (right == nullptr) {
-    return left;
-  }
-
-  Node* result = nullptr;
-
-  if (left->val_ <= right->val_) {
-    result = left;
-    result->p_next_ = merge(left->p_next_, right);
-    result->p_next_->p_prev_ = result;
-  } else {
-    result = right;
-    result->p_next_ = merge(left, right->p_next_);
-    result->p_next_->p_prev_ = result;
-  }
-  return result;
+  // iterative, so the depth of the stack doesn't grow with the size
+  Node* last = nullptr;
+  return merge_chains(left, nullptr, right, nullptr, &last,
+                      std::less<value_type>());
 }
 
 template <typename value_type>
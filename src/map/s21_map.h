@@ -4,14 +4,16 @@
 #include <initializer_list>
 #include <iostream>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
 
 #include "binary_tree/binary_tree.h"
 #include "vector/s21_vector.h"  // for bonus task
 
 namespace s21 {
 
-template <typename K, typename T>
-class map : public BinaryTree<K, std::pair<const K, T>> {
+template <typename K, typename T, typename Compare = std::less<K>>
+class map : public BinaryTree<K, std::pair<const K, T>, Compare> {
  public:
   // Member type
   using key_type = K;
@@ -19,11 +21,12 @@ class map : public BinaryTree<K, std::pair<const K, T>> {
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = BinaryTreeIterator<K, value_type>;
-  using const_iterator = ConstBinaryTreeIterator<K, value_type>;
+  using iterator = BinaryTreeIterator<K, value_type, Compare>;
+  using const_iterator = ConstBinaryTreeIterator<K, value_type, Compare>;
   using size_type = size_t;
+  using node_type = TreeNodeHandle<value_type>;
 
-  using BinaryTreeMap = BinaryTree<K, value_type>;
+  using BinaryTreeMap = BinaryTree<K, value_type, Compare>;
 
   // Functions
   map();
@@ -33,8 +36,14 @@ class map : public BinaryTree<K, std::pair<const K, T>> {
   ~map() = default;
   map &operator=(map other);
 
+  // Deep copy made by n_threads threads
+  map copy_parallel(unsigned n_threads) const;
+
   // Element access
   T &at(const K &key);
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  T &at(const KeyLike &key);
   T &operator[](const K &key);
 
   // Iterators
@@ -48,110 +57,158 @@ class map : public BinaryTree<K, std::pair<const K, T>> {
 
   // Modifiers
   using BinaryTreeMap::clear;
+  using BinaryTreeMap::emplace;
+  using BinaryTreeMap::emplace_hint;
   using BinaryTreeMap::erase;
+  using BinaryTreeMap::erase_above;
+  using BinaryTreeMap::erase_below;
+  using BinaryTreeMap::erase_if;
+  using BinaryTreeMap::extract;
   using BinaryTreeMap::insert;
   using BinaryTreeMap::merge;
+  using BinaryTreeMap::assign_sorted;
   using BinaryTreeMap::swap;
 
-  size_type erase(const K &key);
+  using insert_return_type = typename BinaryTreeMap::insert_return_type;
+
   std::pair<iterator, bool> insert(const K &key, const T &obj);
   std::pair<iterator, bool> insert_or_assign(const K &key, const T &obj);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const K &key, Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(K &&key, Args &&...args);
 
   // Lookup
   using BinaryTreeMap::contains;
+  using BinaryTreeMap::count;
   using BinaryTreeMap::find;
+  using BinaryTreeMap::equal_range;
+  using BinaryTreeMap::lower_bound;
+  using BinaryTreeMap::upper_bound;
+  using BinaryTreeMap::overlapping;
+  using BinaryTreeMap::stabbing;
 
   // Bonus task
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(const Args &&...args);
 
+  // Parallelism
+  using BinaryTreeMap::set_parallel_destruction;
+
   // Debug
   using BinaryTreeMap::print;
+
+ private:
+  map(const map &other, unsigned n_threads);
 };
 
 // Functions
-template <typename K, typename T>
-map<K, T>::map()
-    : BinaryTreeMap([](const value_type &data) { return data.first; }) {}
-
-template <typename K, typename T>
-map<K, T>::map(std::initializer_list<value_type> const &items) : map<K, T>() {
+template <typename K, typename T, typename Compare>
+map<K, T, Compare>::map()
+    : BinaryTreeMap(
+          [](const value_type &data) -> const K & { return data.first; }) {}
+
+template <typename K, typename T, typename Compare>
+map<K, T, Compare>::map(std::initializer_list<value_type> const &items)
+    : map<K, T, Compare>() {
   for (auto item : items) {
     insert(item);
   }
 }
 
-template <typename K, typename T>
-map<K, T>::map(const map &other) : BinaryTreeMap(other) {}
+template <typename K, typename T, typename Compare>
+map<K, T, Compare>::map(const map &other) : BinaryTreeMap(other) {}
+
+template <typename K, typename T, typename Compare>
+map<K, T, Compare>::map(const map &other, unsigned n_threads)
+    : BinaryTreeMap(other, n_threads) {}
 
-template <typename K, typename T>
-map<K, T>::map(map &&other) noexcept : map<K, T>() {
+template <typename K, typename T, typename Compare>
+map<K, T, Compare>::map(map &&other) noexcept : map<K, T, Compare>() {
   swap(other);
 }
 
-template <typename Key, typename T>
-map<Key, T> &map<Key, T>::operator=(map<Key, T> other) {
+template <typename K, typename T, typename Compare>
+map<K, T, Compare> &map<K, T, Compare>::operator=(map<K, T, Compare> other) {
   swap(other);
   return *this;
 }
 
+template <typename K, typename T, typename Compare>
+map<K, T, Compare> map<K, T, Compare>::copy_parallel(unsigned n_threads) const {
+  return map<K, T, Compare>(*this, n_threads);
+}
+
 // Element access
-template <typename K, typename T>
-T &map<K, T>::at(const K &key) {
-  map<K, T>::iterator it = find(key);
+template <typename K, typename T, typename Compare>
+T &map<K, T, Compare>::at(const K &key) {
+  map<K, T, Compare>::iterator it = find(key);
   if (it == end()) {
     throw std::out_of_range("map::at");
   }
   return it->second;
 }
 
-template <typename K, typename T>
-T &map<K, T>::operator[](const K &key) {
-  map<K, T>::iterator it = find(key);
-  if (it != end()) {
-    return it->second;
+template <typename K, typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+T &map<K, T, Compare>::at(const KeyLike &key) {
+  map<K, T, Compare>::iterator it = find(key);
+  if (it == end()) {
+    throw std::out_of_range("map::at");
   }
-
-  it = insert(key, T()).first;
   return it->second;
 }
 
+template <typename K, typename T, typename Compare>
+T &map<K, T, Compare>::operator[](const K &key) {
+  return try_emplace(key).first->second;
+}
+
 // Iterators
 // Capacity
 
 // Modifiers
-template <typename K, typename T>
-typename map<K, T>::size_type map<K, T>::erase(const K &key) {
-  map<K, T>::iterator it = find(key);
-  if (it == end()) return 0;
-  erase(it);
-  return 1;
+template <typename K, typename T, typename Compare>
+std::pair<typename map<K, T, Compare>::iterator, bool>
+map<K, T, Compare>::insert(const K &key, const T &obj) {
+  return try_emplace(key, obj);
 }
 
-template <typename K, typename T>
-std::pair<typename map<K, T>::iterator, bool> map<K, T>::insert(const K &key,
-                                                                const T &obj) {
-  return insert({key, obj});
+template <typename K, typename T, typename Compare>
+std::pair<typename map<K, T, Compare>::iterator, bool>
+map<K, T, Compare>::insert_or_assign(const K &key, const T &obj) {
+  std::pair<iterator, bool> res = try_emplace(key, obj);
+  if (!res.second) res.first->second = obj;
+  return res;
 }
 
-template <typename K, typename T>
-std::pair<typename map<K, T>::iterator, bool> map<K, T>::insert_or_assign(
-    const K &key, const T &obj) {
-  map<K, T>::iterator it = find(key);
-  if (it == end()) {
-    return insert({key, obj});
-  }
+// Inserts {key, T(args...)} if the key is absent. Unlike insert, it
+// descends the tree once and neither constructs nor copies a T when
+// the key is already there.
+template <typename K, typename T, typename Compare>
+template <typename... Args>
+std::pair<typename map<K, T, Compare>::iterator, bool>
+map<K, T, Compare>::try_emplace(const K &key, Args &&...args) {
+  return this->EmplaceKey(key, std::piecewise_construct,
+                          std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+}
 
-  it->second = obj;
-  return {it, false};
+template <typename K, typename T, typename Compare>
+template <typename... Args>
+std::pair<typename map<K, T, Compare>::iterator, bool>
+map<K, T, Compare>::try_emplace(K &&key, Args &&...args) {
+  return this->EmplaceKey(key, std::piecewise_construct,
+                          std::forward_as_tuple(std::move(key)),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
 }
 
 // Bonus task
-template <typename K, typename T>
+template <typename K, typename T, typename Compare>
 template <typename... Args>
-vector<std::pair<typename map<K, T>::iterator, bool>> map<K, T>::insert_many(
-    const Args &&...args) {
-  vector<std::pair<typename map<K, T>::iterator, bool>> res;
+vector<std::pair<typename map<K, T, Compare>::iterator, bool>>
+map<K, T, Compare>::insert_many(const Args &&...args) {
+  vector<std::pair<typename map<K, T, Compare>::iterator, bool>> res;
   for (const auto &e : {args...}) {
     res.push_back(insert(e));
   }
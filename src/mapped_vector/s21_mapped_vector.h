@@ -0,0 +1,326 @@
+#ifndef S21_CONTAINERS_MAPPED_VECTOR_MAPPED_VECTOR_H_  // NOLINT
+#define S21_CONTAINERS_MAPPED_VECTOR_MAPPED_VECTOR_H_  // NOLINT
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// The first bytes of a mapped_vector file. The elements follow at
+// kDataOffset, so any element alignment up to 64 is kept.
+struct MappedVectorHeader {
+  static constexpr char kMagic[8] = {'S', '2', '1', 'M', 'V', 'E', 'C', '\0'};
+  static constexpr uint32_t kVersion = 1;
+  static constexpr size_t kDataOffset = 64;
+
+  char magic[8];
+  uint32_t version;
+  uint32_t element_size;
+  uint64_t size;
+};
+
+// A vector of trivially copyable elements that lives in a file mapped
+// into memory. Opening an existing file maps it and reads nothing, so
+// a dataset of any size is ready in O(1) and the elements are never
+// copied or parsed. Changes reach the file through the page cache;
+// flush() waits until they are on disk.
+//
+// It has the read interface of s21::vector and appends at the end.
+// Growing extends the file geometrically with ftruncate and maps it
+// again, so like a reallocation it invalidates pointers. The file is
+// cut to the elements it holds when the vector is destroyed.
+//
+// The file starts with a versioned header (see MappedVectorHeader)
+// recording the element size; files of another format, version or
+// element size are rejected. The elements are stored in the byte order
+// of the machine.
+template <typename T>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mapped_vector needs trivially copyable elements");
+  static_assert(alignof(T) <= MappedVectorHeader::kDataOffset,
+                "mapped_vector elements are aligned to 64 at most");
+
+ public:
+  // types
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  // constructors
+  // Opens the file at path or creates an empty one.
+  explicit mapped_vector(const std::string &path);
+  mapped_vector(const mapped_vector &v) = delete;
+  mapped_vector(mapped_vector &&v) noexcept;
+  ~mapped_vector();
+
+  // overload
+  mapped_vector &operator=(const mapped_vector &v) = delete;
+  mapped_vector &operator=(mapped_vector &&v) noexcept;
+
+  // element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) { return data()[pos]; }
+  const_reference operator[](size_type pos) const { return data()[pos]; }
+  reference front() { return data()[0]; }
+  const_reference front() const { return data()[0]; }
+  reference back() { return data()[size() - 1]; }
+  const_reference back() const { return data()[size() - 1]; }
+  T *data() noexcept { return reinterpret_cast<T *>(Data()); }
+  const T *data() const noexcept {
+    return reinterpret_cast<const T *>(Data());
+  }
+
+  // iterators
+  iterator begin() noexcept { return data(); }
+  const_iterator begin() const noexcept { return data(); }
+  iterator end() noexcept { return data() + size(); }
+  const_iterator end() const noexcept { return data() + size(); }
+
+  // capacity
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept { return base_ ? Header()->size : 0; }
+  size_type max_size() const noexcept {
+    return (std::numeric_limits<off_t>::max() -
+            MappedVectorHeader::kDataOffset) /
+           sizeof(T);
+  }
+  void reserve(size_type size);
+  size_type capacity() const noexcept { return capacity_; }
+  void shrink_to_fit();
+
+  // modifiers
+  void clear() noexcept {
+    if (base_) Header()->size = 0;
+  }
+  void push_back(const_reference value);
+  void pop_back() noexcept {
+    if (base_) --Header()->size;
+  }
+  void swap(mapped_vector &other) noexcept;
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+  // Writes the changes to the file and waits until they are on disk
+  void flush();
+
+ private:
+  MappedVectorHeader *Header() const noexcept {
+    return reinterpret_cast<MappedVectorHeader *>(base_);
+  }
+  char *Data() const noexcept {
+    return base_ ? base_ + MappedVectorHeader::kDataOffset : nullptr;
+  }
+  static size_t FileSize(size_type capacity) noexcept {
+    return MappedVectorHeader::kDataOffset + capacity * sizeof(T);
+  }
+
+  // Resizes the file to capacity elements and maps it again. The old
+  // mapping is dropped only when the new one is in place.
+  void Remap(size_type capacity);
+  void Map(size_t bytes);
+  void Close() noexcept;
+  [[noreturn]] static void Fail(const char *what);
+
+  int fd_ = -1;
+  char *base_ = nullptr;
+  size_t mapped_bytes_ = 0;
+  size_type capacity_ = 0;
+};
+
+// definitions
+template <typename T>
+mapped_vector<T>::mapped_vector(const std::string &path) {
+  fd_ = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (fd_ < 0) Fail("mapped_vector: can't open the file");
+  struct stat st;
+  if (fstat(fd_, &st) != 0) {
+    Close();
+    Fail("mapped_vector: can't stat the file");
+  }
+
+  try {
+    if (st.st_size == 0) {
+      Remap(0);
+      MappedVectorHeader *header = Header();
+      std::memcpy(header->magic, MappedVectorHeader::kMagic,
+                  sizeof(header->magic));
+      header->version = MappedVectorHeader::kVersion;
+      header->element_size = sizeof(T);
+      header->size = 0;
+      return;
+    }
+
+    size_t file_size = st.st_size;
+    if (file_size < MappedVectorHeader::kDataOffset)
+      throw std::runtime_error("mapped_vector: not a mapped_vector file");
+    Map(file_size);
+    const MappedVectorHeader *header = Header();
+    if (std::memcmp(header->magic, MappedVectorHeader::kMagic,
+                    sizeof(header->magic)) != 0)
+      throw std::runtime_error("mapped_vector: not a mapped_vector file");
+    if (header->version != MappedVectorHeader::kVersion)
+      throw std::runtime_error("mapped_vector: unsupported file version");
+    if (header->element_size != sizeof(T))
+      throw std::runtime_error("mapped_vector: wrong element size");
+    capacity_ = (file_size - MappedVectorHeader::kDataOffset) / sizeof(T);
+    if (header->size > capacity_)
+      throw std::runtime_error("mapped_vector: the file is truncated");
+  } catch (...) {
+    Close();
+    throw;
+  }
+}
+
+template <typename T>
+mapped_vector<T>::mapped_vector(mapped_vector &&v) noexcept {
+  swap(v);
+}
+
+// Drops the unused capacity from the file and closes it
+template <typename T>
+mapped_vector<T>::~mapped_vector() {
+  if (base_) {
+    size_t used = FileSize(size());
+    munmap(base_, mapped_bytes_);
+    base_ = nullptr;
+    // on failure the file just keeps its unused capacity
+    int res = ftruncate(fd_, used);
+    (void)res;
+  }
+  Close();
+}
+
+template <typename T>
+mapped_vector<T> &mapped_vector<T>::operator=(mapped_vector &&v) noexcept {
+  if (this != &v) {
+    mapped_vector tmp(std::move(v));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T>
+T &mapped_vector<T>::at(size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("out of range");
+  }
+  return data()[pos];
+}
+
+template <typename T>
+const T &mapped_vector<T>::at(size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("out of range");
+  }
+  return data()[pos];
+}
+
+template <typename T>
+void mapped_vector<T>::reserve(size_type size) {
+  if (size > capacity_) {
+    if (size > max_size()) throw std::length_error("mapped_vector too long");
+    Remap(size);
+  }
+}
+
+template <typename T>
+void mapped_vector<T>::shrink_to_fit() {
+  if (size() < capacity_) Remap(size());
+}
+
+template <typename T>
+void mapped_vector<T>::push_back(const_reference value) {
+  if (size() == capacity_) {
+    value_type tmp(value);
+    reserve(capacity_ * 2 + 1);
+    data()[Header()->size++] = tmp;
+  } else {
+    data()[Header()->size++] = value;
+  }
+}
+
+template <typename T>
+void mapped_vector<T>::swap(mapped_vector &other) noexcept {
+  std::swap(fd_, other.fd_);
+  std::swap(base_, other.base_);
+  std::swap(mapped_bytes_, other.mapped_bytes_);
+  std::swap(capacity_, other.capacity_);
+}
+
+template <typename T>
+template <typename... Args>
+void mapped_vector<T>::insert_many_back(Args &&...args) {
+  size_type required = size() + sizeof...(args);
+  if (required > capacity_) {
+    value_type items[] = {value_type(std::forward<Args>(args))...};
+    reserve(std::max(capacity_ * 2 + 1, required));
+    for (const value_type &item : items) data()[Header()->size++] = item;
+  } else {
+    ((data()[Header()->size++] = value_type(std::forward<Args>(args))), ...);
+  }
+}
+
+template <typename T>
+void mapped_vector<T>::flush() {
+  if (base_ && msync(base_, mapped_bytes_, MS_SYNC) != 0)
+    Fail("mapped_vector: msync failed");
+}
+
+template <typename T>
+void mapped_vector<T>::Remap(size_type capacity) {
+  size_t bytes = FileSize(capacity);
+  if (ftruncate(fd_, bytes) != 0) Fail("mapped_vector: can't resize the file");
+  char *old_base = base_;
+  size_t old_bytes = mapped_bytes_;
+  Map(bytes);
+  if (old_base) munmap(old_base, old_bytes);
+  capacity_ = capacity;
+}
+
+template <typename T>
+void mapped_vector<T>::Map(size_t bytes) {
+  void *p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (p == MAP_FAILED) Fail("mapped_vector: mmap failed");
+  base_ = static_cast<char *>(p);
+  mapped_bytes_ = bytes;
+}
+
+template <typename T>
+void mapped_vector<T>::Close() noexcept {
+  if (base_) munmap(base_, mapped_bytes_);
+  if (fd_ >= 0) close(fd_);
+  base_ = nullptr;
+  fd_ = -1;
+}
+
+template <typename T>
+void mapped_vector<T>::Fail(const char *what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+}  // namespace s21
+
+#endif  // defined(__unix__) || defined(__APPLE__)
+
+#endif  // S21_CONTAINERS_MAPPED_VECTOR_MAPPED_VECTOR_H_  // NOLINT
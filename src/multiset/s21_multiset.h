@@ -2,6 +2,9 @@
 #define S21_CONTAINERS_S21_MULTISET_H_  // NOLINT
 
 #include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 #ifdef DEBUG
 #include <iostream>
@@ -12,21 +15,23 @@
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Compare = std::less<T>>
 class multiset;
 
-template <typename T>
+template <typename T, typename Compare>
 class MultisetIterator {
-  friend class multiset<T>;
+  friend class multiset<T, Compare>;
   using data_type = std::pair<const T, size_t>;
 
  public:
   MultisetIterator() = default;
 
-  MultisetIterator(const multiset<T> *owner, Node<data_type> *p)
+  MultisetIterator(const multiset<T, Compare> *owner, Node<data_type> *p)
       : owner_(owner), p_(p), counter_(1) {}
 
-  typename multiset<T>::const_reference operator*() { return p_->data_.first; }
+  typename multiset<T, Compare>::const_reference operator*() {
+    return p_->data_.first;
+  }
 
   MultisetIterator &operator++() {
     if (counter_ < p_->data_.second)
@@ -61,14 +66,14 @@ class MultisetIterator {
   bool operator!=(MultisetIterator other) const { return !(*this == other); }
 
  private:
-  const multiset<T> *owner_ = nullptr;
+  const multiset<T, Compare> *owner_ = nullptr;
   Node<data_type> *p_ = nullptr;
   size_t counter_ = 0;
 };
 
-template <typename T>
+template <typename T, typename Compare>
 class multiset {
-  friend class MultisetIterator<T>;
+  friend class MultisetIterator<T, Compare>;
 
  public:
   // Member type
@@ -76,11 +81,12 @@ class multiset {
   using value_type = T;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = MultisetIterator<T>;
-  using const_iterator = MultisetIterator<T>;
+  using iterator = MultisetIterator<T, Compare>;
+  using const_iterator = MultisetIterator<T, Compare>;
   using size_type = size_t;
 
   using data_type = std::pair<const T, size_t>;
+  using node_type = TreeNodeHandle<data_type, const T>;
 
   // Functions
   multiset() = default;
@@ -90,6 +96,9 @@ class multiset {
   ~multiset();
   multiset &operator=(multiset other);
 
+  // Deep copy made by n_threads threads
+  multiset copy_parallel(unsigned n_threads) const;
+
   // Iterators
   iterator begin() const noexcept;
   iterator end() const noexcept;
@@ -105,98 +114,177 @@ class multiset {
   void erase(iterator pos);
   void swap(multiset &other) noexcept;
   void merge(multiset &other);
+  iterator insert(node_type &&nh);
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last);
+  node_type extract(iterator pos);
+  node_type extract(const key_type &key);
+
+  // Removes all the elements with the key, returns their number
+  size_type erase(const key_type &key);
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent,
+            typename = std::enable_if_t<
+                !std::is_convertible<KeyLike, iterator>::value>>
+  size_type erase(const KeyLike &key);
+
+  // Range removal in O(k + log n) for k erased distinct keys
+  iterator erase(iterator first, iterator last);
+  template <typename Pred>
+  size_type erase_if(Pred pred);
+  size_type erase_below(const key_type &key);
+  size_type erase_above(const key_type &key);
 
   // Lookup
   size_type count(const key_type &key) const noexcept;
-  iterator find(const value_type &val) const noexcept;
-  bool contains(const value_type &val) const noexcept;
+  iterator find(const key_type &key) const noexcept;
+  bool contains(const key_type &key) const noexcept;
   std::pair<iterator, iterator> equal_range(const key_type &key) const noexcept;
   iterator lower_bound(const key_type &key) const noexcept;
   iterator upper_bound(const key_type &key) const noexcept;
 
+  // Heterogeneous lookup, only for a transparent Compare
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const KeyLike &key) const noexcept;
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const KeyLike &key) const noexcept;
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const KeyLike &key) const noexcept;
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const KeyLike &key) const noexcept;
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const KeyLike &key) const noexcept;
+  template <typename KeyLike, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const KeyLike &key) const noexcept;
+
   // Bonus task
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(const Args &&...args);
 
+  // Parallelism
+  void set_parallel_destruction(unsigned n_threads) noexcept;
+
   // Debug
   void print();
 
  private:
+  multiset(const multiset &other, unsigned n_threads);
+
   Node<data_type> *root_ = nullptr;
   size_type size_ = 0;
-  AvlTreeOperations<T, data_type> avl_oper_{
-      [](const data_type &data) { return data.first; }};
+
+  // Number of threads used by clear() and the destructor.
+  // It goes with the nodes on swap and move, so the old tree of an
+  // assigned container is still destroyed in parallel; copies start at 1.
+  unsigned destroy_threads_ = 1;
+  template <typename KeyLike>
+  size_type EraseKey(const KeyLike &key);
+  template <typename KeyLike>
+  size_type CountKey(const KeyLike &key) const noexcept;
+
+  using Position =
+      typename AvlTreeOperations<T, data_type, Compare>::Position;
+
+  AvlTreeOperations<T, data_type, Compare> avl_oper_{
+      [](const data_type &data) -> const T & { return data.first; }};
 };
 
 // Functions
-template <typename T>
-multiset<T>::multiset(std::initializer_list<value_type> const &items) {
+template <typename T, typename Compare>
+multiset<T, Compare>::multiset(std::initializer_list<value_type> const &items) {
   for (auto item : items) {
     insert(item);
   }
 }
 
-template <typename T>
-multiset<T>::multiset(const multiset &other)
+template <typename T, typename Compare>
+multiset<T, Compare>::multiset(const multiset &other)
     : root_(nullptr), size_(other.size_), avl_oper_(other.avl_oper_) {
   root_ = avl_oper_.Copy(other.root_);
 }
 
-template <typename T>
-multiset<T>::multiset(multiset &&other) noexcept {
+template <typename T, typename Compare>
+multiset<T, Compare>::multiset(const multiset &other, unsigned n_threads)
+    : root_(nullptr), size_(other.size_), avl_oper_(other.avl_oper_) {
+  root_ = avl_oper_.CopyParallel(other.root_, n_threads);
+}
+
+template <typename T, typename Compare>
+multiset<T, Compare>::multiset(multiset &&other) noexcept {
   swap(other);
 }
 
-template <typename T>
-multiset<T>::~multiset() {
-  avl_oper_.Clear(root_);
+template <typename T, typename Compare>
+multiset<T, Compare>::~multiset() {
+  clear();
 }
 
-template <typename T>
-multiset<T> &multiset<T>::operator=(multiset<T> other) {
+template <typename T, typename Compare>
+multiset<T, Compare> &multiset<T, Compare>::operator=(
+    multiset<T, Compare> other) {
   swap(other);
   return *this;
 }
 
+template <typename T, typename Compare>
+multiset<T, Compare> multiset<T, Compare>::copy_parallel(
+    unsigned n_threads) const {
+  return multiset<T, Compare>(*this, n_threads);
+}
+
 // Iterators
-template <typename T>
-typename multiset<T>::iterator multiset<T>::begin() const noexcept {
-  Node<typename multiset<T>::data_type> *p = root_;
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::begin()
+    const noexcept {
+  Node<typename multiset<T, Compare>::data_type> *p = root_;
   while (p && p->left_) p = p->left_;
-  return MultisetIterator<T>(this, p);
+  return MultisetIterator<T, Compare>(this, p);
 }
 
-template <typename T>
-typename multiset<T>::iterator multiset<T>::end() const noexcept {
-  return MultisetIterator<T>(this, nullptr);
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::end()
+    const noexcept {
+  return MultisetIterator<T, Compare>(this, nullptr);
 }
 
 // Capacity
-template <typename T>
-bool multiset<T>::empty() const noexcept {
+template <typename T, typename Compare>
+bool multiset<T, Compare>::empty() const noexcept {
   return root_ == nullptr;
 }
 
-template <typename T>
-typename multiset<T>::size_type multiset<T>::size() const noexcept {
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::size()
+    const noexcept {
   return size_;
 }
 
-template <typename T>
-typename multiset<T>::size_type multiset<T>::max_size() const noexcept {
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::max_size()
+    const noexcept {
   return (~(size_type(0))) / sizeof(Node<T>);
 }
 
 // Modifiers
-template <typename T>
-void multiset<T>::clear() {
-  root_ = avl_oper_.Clear(root_);
+template <typename T, typename Compare>
+void multiset<T, Compare>::clear() {
+  if (destroy_threads_ > 1)
+    root_ = avl_oper_.ClearParallel(root_, destroy_threads_);
+  else
+    root_ = avl_oper_.Clear(root_);
   size_ = 0;
 }
 
-template <typename T>
-typename multiset<T>::iterator multiset<T>::insert(const value_type &value) {
-  MultisetIterator<T> it = find(value);
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::insert(
+    const value_type &value) {
+  MultisetIterator<T, Compare> it = find(value);
   if (it != end()) {
     ++it.p_->data_.second;
     ++size_;
@@ -207,8 +295,8 @@ typename multiset<T>::iterator multiset<T>::insert(const value_type &value) {
   return find(value);
 }
 
-template <typename T>
-void multiset<T>::erase(iterator pos) {
+template <typename T, typename Compare>
+void multiset<T, Compare>::erase(iterator pos) {
   size_t &counter = pos.p_->data_.second;
   if (counter > 1) {
     --counter;
@@ -218,15 +306,17 @@ void multiset<T>::erase(iterator pos) {
   --size_;
 }
 
-template <typename T>
-void multiset<T>::swap(multiset<T> &other) noexcept {
+template <typename T, typename Compare>
+void multiset<T, Compare>::swap(multiset<T, Compare> &other) noexcept {
   using std::swap;
   swap(root_, other.root_);
   swap(size_, other.size_);
+  swap(avl_oper_, other.avl_oper_);
+  swap(destroy_threads_, other.destroy_threads_);
 }
 
-template <typename T>
-void multiset<T>::merge(multiset<T> &other) {  // NOLINT
+template <typename T, typename Compare>
+void multiset<T, Compare>::merge(multiset<T, Compare> &other) {  // NOLINT
   Node<data_type> *p = other.begin().p_;
   while (p) {
     Node<data_type> *node = p;
@@ -235,7 +325,7 @@ void multiset<T>::merge(multiset<T> &other) {  // NOLINT
 
     other.root_ = other.avl_oper_.ExtractNode(other.root_, node);
 
-    T node_key = node->data_.first;
+    const T &node_key = node->data_.first;
     Node<data_type> *found = avl_oper_.Find(root_, node_key);
     if (!found) {
       root_ = avl_oper_.InsertNode(root_, node);
@@ -249,67 +339,295 @@ void multiset<T>::merge(multiset<T> &other) {  // NOLINT
   }
 }
 
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::erase(
+    const key_type &key) {
+  return EraseKey(key);
+}
+
+template <typename T, typename Compare>
+template <typename KeyLike, typename C, typename, typename>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::erase(
+    const KeyLike &key) {
+  return EraseKey(key);
+}
+
+template <typename T, typename Compare>
+template <typename KeyLike>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::EraseKey(
+    const KeyLike &key) {
+  Node<data_type> *p = avl_oper_.Find(root_, key);
+  if (!p) return 0;
+  size_type counter = p->data_.second;
+  root_ = avl_oper_.Remove(root_, p);
+  size_ -= counter;
+  return counter;
+}
+
+// Erases the elements in [first, last) and returns last. Only the
+// counters of the nodes at the ends of the range may need to be
+// decreased; the nodes in between are cut out with two splits and a
+// join.
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::erase(
+    iterator first, iterator last) {
+  if (first == last) return last;
+  if (first.p_ == last.p_) {
+    size_type n = last.counter_ - first.counter_;
+    first.p_->data_.second -= n;
+    size_ -= n;
+    return first;
+  }
+
+  Node<data_type> *from = first.p_;
+  if (first.counter_ > 1) {
+    size_type n = from->data_.second - first.counter_ + 1;
+    from->data_.second -= n;
+    size_ -= n;
+    from = avl_oper_.Next(root_, from);
+  }
+  if (last.p_ && last.counter_ > 1) {
+    last.p_->data_.second -= last.counter_ - 1;
+    size_ -= last.counter_ - 1;
+    last.counter_ = 1;
+  }
+  if (from == last.p_) return last;
+
+  Node<data_type> *left, *mid, *right = nullptr;
+  avl_oper_.Split(root_, from->data_.first, false, &left, &mid);
+  if (last.p_)
+    avl_oper_.Split(mid, last.p_->data_.first, false, &mid, &right);
+  avl_oper_.Clear(mid,
+                  [this](Node<data_type> *p) { size_ -= p->data_.second; });
+  root_ = avl_oper_.Join(left, right);
+  return last;
+}
+
+// Erases all the elements satisfying pred, returns their number
+template <typename T, typename Compare>
+template <typename Pred>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::erase_if(
+    Pred pred) {
+  size_type old_size = size_;
+  avl_oper_.RemoveIf(
+      &root_,
+      [&pred](const data_type &data) -> bool { return pred(data.first); },
+      [this](Node<data_type> *p) { size_ -= p->data_.second; });
+  return old_size - size_;
+}
+
+// Erases all the elements less than key, returns their number
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::erase_below(
+    const key_type &key) {
+  size_type old_size = size_;
+  Node<data_type> *below;
+  avl_oper_.Split(root_, key, false, &below, &root_);
+  avl_oper_.Clear(below,
+                  [this](Node<data_type> *p) { size_ -= p->data_.second; });
+  return old_size - size_;
+}
+
+// Erases all the elements greater than key, returns their number
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::erase_above(
+    const key_type &key) {
+  size_type old_size = size_;
+  Node<data_type> *above;
+  avl_oper_.Split(root_, key, true, &root_, &above);
+  avl_oper_.Clear(above,
+                  [this](Node<data_type> *p) { size_ -= p->data_.second; });
+  return old_size - size_;
+}
+
+// Inserts the element of the handle. Its node is reused unless the key
+// is already there: equal elements share one node with a counter.
+// The handle keeps the node until the search, which may throw, is done.
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::insert(
+    node_type &&nh) {
+  if (nh.empty()) return end();
+
+  Position pos;
+  Node<data_type> *found =
+      avl_oper_.FindPosition(root_, nh.node_->data_.first, &pos);
+  size_type counter = nh.node_->data_.second;
+  if (found) {
+    found->data_.second += counter;
+    size_ += counter;
+    nh = node_type();
+    return iterator(this, found);
+  }
+  Node<data_type> *node = nh.Release();
+  root_ = avl_oper_.InsertAt(&pos, node);
+  size_ += counter;
+  return iterator(this, node);
+}
+
+// Extracts one element. The node itself is handed over if it holds the
+// last copy of the key, otherwise a new node is made for the element.
+template <typename T, typename Compare>
+typename multiset<T, Compare>::node_type multiset<T, Compare>::extract(
+    iterator pos) {
+  size_t &counter = pos.p_->data_.second;
+  if (counter > 1) {
+    node_type nh(new Node<data_type>({pos.p_->data_.first, 1}));
+    --counter;
+    --size_;
+    return nh;
+  }
+  root_ = avl_oper_.ExtractNode(root_, pos.p_);
+  --size_;
+  return node_type(pos.p_);
+}
+
+template <typename T, typename Compare>
+typename multiset<T, Compare>::node_type multiset<T, Compare>::extract(
+    const key_type &key) {
+  iterator it = find(key);
+  if (it == end()) return node_type();
+  return extract(it);
+}
+
 // Lookup
-template <typename T>
-typename multiset<T>::size_type multiset<T>::count(
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::count(
     const key_type &key) const noexcept {
-  size_t res = 0;
-  auto it = find(key);
-  if (it != end()) res = it.p_->data_.second;
-  return res;
+  return CountKey(key);
 }
 
-template <typename T>
-MultisetIterator<T> multiset<T>::find(const key_type &key) const noexcept {
-  return MultisetIterator<T>(this, avl_oper_.Find(root_, key));
+template <typename T, typename Compare>
+MultisetIterator<T, Compare> multiset<T, Compare>::find(
+    const key_type &key) const noexcept {
+  return MultisetIterator<T, Compare>(this, avl_oper_.Find(root_, key));
 }
 
-template <typename T>
-bool multiset<T>::contains(const key_type &key) const noexcept {
+template <typename T, typename Compare>
+bool multiset<T, Compare>::contains(const key_type &key) const noexcept {
   return avl_oper_.Find(root_, key);
 }
 
-template <typename T>
-std::pair<MultisetIterator<T>, MultisetIterator<T>> multiset<T>::equal_range(
-    const key_type &key) const noexcept {
+template <typename T, typename Compare>
+std::pair<MultisetIterator<T, Compare>, MultisetIterator<T, Compare>>
+multiset<T, Compare>::equal_range(const key_type &key) const noexcept {
   return {lower_bound(key), upper_bound(key)};
 }
 
-template <typename T>
-MultisetIterator<T> multiset<T>::lower_bound(
+template <typename T, typename Compare>
+MultisetIterator<T, Compare> multiset<T, Compare>::lower_bound(
     const key_type &key) const noexcept {
-  auto it = begin();
-  if (*it < key) it = find(key);
-  return it;
+  return MultisetIterator<T, Compare>(this, avl_oper_.LowerBound(root_, key));
 }
 
-template <typename T>
-MultisetIterator<T> multiset<T>::upper_bound(
+template <typename T, typename Compare>
+MultisetIterator<T, Compare> multiset<T, Compare>::upper_bound(
     const key_type &key) const noexcept {
-  auto it = begin();
-  if (*it <= key) {
-    it = find(key);
-    it.MoveNextValue();
-  }
-  return it;
+  return MultisetIterator<T, Compare>(this, avl_oper_.UpperBound(root_, key));
+}
+
+// Heterogeneous lookup
+template <typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::count(
+    const KeyLike &key) const noexcept {
+  return CountKey(key);
+}
+
+template <typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+MultisetIterator<T, Compare> multiset<T, Compare>::find(
+    const KeyLike &key) const noexcept {
+  return MultisetIterator<T, Compare>(this, avl_oper_.Find(root_, key));
+}
+
+template <typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+bool multiset<T, Compare>::contains(const KeyLike &key) const noexcept {
+  return avl_oper_.Find(root_, key);
+}
+
+template <typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+std::pair<MultisetIterator<T, Compare>, MultisetIterator<T, Compare>>
+multiset<T, Compare>::equal_range(const KeyLike &key) const noexcept {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+template <typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+MultisetIterator<T, Compare> multiset<T, Compare>::lower_bound(
+    const KeyLike &key) const noexcept {
+  return MultisetIterator<T, Compare>(this, avl_oper_.LowerBound(root_, key));
+}
+
+template <typename T, typename Compare>
+template <typename KeyLike, typename C, typename>
+MultisetIterator<T, Compare> multiset<T, Compare>::upper_bound(
+    const KeyLike &key) const noexcept {
+  return MultisetIterator<T, Compare>(this, avl_oper_.UpperBound(root_, key));
+}
+
+template <typename T, typename Compare>
+template <typename KeyLike>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::CountKey(
+    const KeyLike &key) const noexcept {
+  Node<data_type> *p = avl_oper_.Find(root_, key);
+  return p ? p->data_.second : 0;
 }
 
 // Bonus task
-template <typename T>
+template <typename T, typename Compare>
 template <typename... Args>
-vector<std::pair<typename multiset<T>::iterator, bool>>
-multiset<T>::insert_many(const Args &&...args) {
-  vector<std::pair<typename multiset<T>::iterator, bool>> res;
+vector<std::pair<typename multiset<T, Compare>::iterator, bool>>
+multiset<T, Compare>::insert_many(const Args &&...args) {
+  vector<std::pair<typename multiset<T, Compare>::iterator, bool>> res;
   for (const auto &e : {args...}) {
     res.push_back({insert(e), true});
   }
   return res;
 }
 
+// Replaces the contents with [first, last), which must be sorted
+// (otherwise std::invalid_argument is thrown and the multiset is left
+// as it was). Builds a balanced tree in O(n).
+template <typename T, typename Compare>
+template <typename InputIt>
+void multiset<T, Compare>::assign_sorted(InputIt first, InputIt last) {
+  std::vector<Node<data_type> *> nodes;
+  size_type count = 0;
+  try {
+    for (; first != last; ++first, ++count) {
+      if (!nodes.empty() &&
+          !avl_oper_.Less(nodes.back()->data_.first, *first)) {
+        if (avl_oper_.Less(*first, nodes.back()->data_.first))
+          throw std::invalid_argument("assign_sorted: the range isn't sorted");
+        ++nodes.back()->data_.second;
+        continue;
+      }
+      nodes.push_back(nullptr);
+      nodes.back() = new Node<data_type>(std::in_place, *first, size_t(1));
+    }
+  } catch (...) {
+    for (Node<data_type> *p : nodes) delete p;
+    throw;
+  }
+  clear();
+  root_ = avl_oper_.Build(nodes.data(), nodes.size());
+  size_ = count;
+}
+
+// Parallelism
+// Makes clear() and the destructor free the nodes on n_threads threads.
+template <typename T, typename Compare>
+void multiset<T, Compare>::set_parallel_destruction(
+    unsigned n_threads) noexcept {
+  destroy_threads_ = n_threads;
+}
+
 // Debug
 #ifdef DEBUG
-template <typename T>
-void multiset<T>::print() {
+template <typename T, typename Compare>
+void multiset<T, Compare>::print() {
   if (empty()) {
     std::cout << "multiset is empty";
   } else {
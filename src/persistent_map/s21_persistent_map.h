@@ -0,0 +1,118 @@
+#ifndef S21_CONTAINERS_S21_PERSISTENT_MAP_H_  // NOLINT
+#define S21_CONTAINERS_S21_PERSISTENT_MAP_H_  // NOLINT
+
+#include <initializer_list>
+#include <stdexcept>
+
+#include "binary_tree/persistent_tree.h"
+
+namespace s21 {
+
+// Immutable-by-version map: copies and snapshots are O(1) and
+// share all the nodes, updates copy O(log n) nodes.
+template <typename K, typename T>
+class persistent_map : public PersistentTree<K, std::pair<const K, T>> {
+ public:
+  // Member type
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = PersistentTreeIterator<K, value_type>;
+  using const_iterator = PersistentTreeIterator<K, value_type>;
+  using size_type = size_t;
+
+  using PersistentTreeMap = PersistentTree<K, value_type>;
+
+  // Functions
+  persistent_map();
+  persistent_map(std::initializer_list<value_type> const &items);
+  persistent_map(const persistent_map &other) = default;
+  persistent_map(persistent_map &&other) noexcept;
+  ~persistent_map() = default;
+  persistent_map &operator=(persistent_map other) noexcept;
+
+  persistent_map snapshot() const noexcept { return *this; }
+
+  // Element access
+  const T &at(const K &key) const;
+
+  // Iterators
+  using PersistentTreeMap::begin;
+  using PersistentTreeMap::end;
+
+  // Capacity
+  using PersistentTreeMap::empty;
+  using PersistentTreeMap::max_size;
+  using PersistentTreeMap::size;
+
+  // Modifiers
+  using PersistentTreeMap::clear;
+  using PersistentTreeMap::erase;
+  using PersistentTreeMap::insert;
+  using PersistentTreeMap::insert_or_assign;
+  using PersistentTreeMap::swap;
+
+  std::pair<iterator, bool> insert(const K &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const K &key, const T &obj);
+
+  // Lookup
+  using PersistentTreeMap::contains;
+  using PersistentTreeMap::find;
+};
+
+// Functions
+template <typename K, typename T>
+persistent_map<K, T>::persistent_map()
+    : PersistentTreeMap(
+          [](const value_type &data) -> const K & { return data.first; }) {}
+
+template <typename K, typename T>
+persistent_map<K, T>::persistent_map(
+    std::initializer_list<value_type> const &items)
+    : persistent_map<K, T>() {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename K, typename T>
+persistent_map<K, T>::persistent_map(persistent_map &&other) noexcept
+    : persistent_map<K, T>() {
+  swap(other);
+}
+
+template <typename K, typename T>
+persistent_map<K, T> &persistent_map<K, T>::operator=(
+    persistent_map<K, T> other) noexcept {
+  swap(other);
+  return *this;
+}
+
+// Element access
+template <typename K, typename T>
+const T &persistent_map<K, T>::at(const K &key) const {
+  iterator it = find(key);
+  if (it == end()) {
+    throw std::out_of_range("persistent_map::at");
+  }
+  return it->second;
+}
+
+// Modifiers
+template <typename K, typename T>
+std::pair<typename persistent_map<K, T>::iterator, bool>
+persistent_map<K, T>::insert(const K &key, const T &obj) {
+  return insert({key, obj});
+}
+
+template <typename K, typename T>
+std::pair<typename persistent_map<K, T>::iterator, bool>
+persistent_map<K, T>::insert_or_assign(const K &key, const T &obj) {
+  return insert_or_assign({key, obj});
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_PERSISTENT_MAP_H_  // NOLINT
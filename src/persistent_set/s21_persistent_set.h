@@ -0,0 +1,77 @@
+#ifndef S21_CONTAINERS_S21_PERSISTENT_SET_H_  // NOLINT
+#define S21_CONTAINERS_S21_PERSISTENT_SET_H_  // NOLINT
+
+#include <initializer_list>
+
+#include "binary_tree/persistent_tree.h"
+
+namespace s21 {
+
+// Immutable-by-version set: copies and snapshots are O(1) and
+// share all the nodes, updates copy O(log n) nodes.
+template <typename T>
+class persistent_set : public PersistentTree<T, T> {
+ public:
+  // Member type
+  using key_type = T;
+  using value_type = T;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = PersistentTreeIterator<T, T>;
+  using const_iterator = PersistentTreeIterator<T, T>;
+  using size_type = size_t;
+
+  // Functions
+  persistent_set() = default;
+  persistent_set(std::initializer_list<value_type> const &items);
+  persistent_set(const persistent_set &other) = default;
+  persistent_set(persistent_set &&other) noexcept;
+  ~persistent_set() = default;
+  persistent_set &operator=(persistent_set other) noexcept;
+
+  persistent_set snapshot() const noexcept { return *this; }
+
+  // Iterators
+  using PersistentTree<T, T>::begin;
+  using PersistentTree<T, T>::end;
+
+  // Capacity
+  using PersistentTree<T, T>::empty;
+  using PersistentTree<T, T>::size;
+  using PersistentTree<T, T>::max_size;
+
+  // Modifiers
+  using PersistentTree<T, T>::clear;
+  using PersistentTree<T, T>::insert;
+  using PersistentTree<T, T>::erase;
+  using PersistentTree<T, T>::swap;
+
+  // Lookup
+  using PersistentTree<T, T>::find;
+  using PersistentTree<T, T>::contains;
+};
+
+// Functions
+template <typename T>
+persistent_set<T>::persistent_set(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+template <typename T>
+persistent_set<T>::persistent_set(persistent_set &&other) noexcept {
+  swap(other);
+}
+
+template <typename T>
+persistent_set<T> &persistent_set<T>::operator=(
+    persistent_set<T> other) noexcept {
+  swap(other);
+  return *this;
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_PERSISTENT_SET_H_  // NOLINT
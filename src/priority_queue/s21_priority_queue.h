@@ -0,0 +1,350 @@
+#ifndef S21_CONTAINERS_PRIORITY_QUEUE_PRIORITY_QUEUE_H_  // NOLINT
+#define S21_CONTAINERS_PRIORITY_QUEUE_PRIORITY_QUEUE_H_  // NOLINT
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "vector/s21_vector.h"
+
+namespace s21 {
+
+// A heap-ordered adaptor over Container (s21::vector by default, or
+// small_vector): top() is the greatest element by Compare, so with
+// std::greater it is the smallest. Each node has Arity children; a
+// 4-ary heap is half as deep as a binary one and compares the children
+// of a node within one or two cache lines, which usually makes pop()
+// faster for small elements.
+template <typename T, typename Container = vector<T>,
+          typename Compare = std::less<T>, size_t Arity = 2>
+class priority_queue {
+  static_assert(Arity >= 2, "a heap node needs at least two children");
+  static constexpr bool kNothrowSwap = noexcept(
+      std::declval<Container &>().swap(std::declval<Container &>()));
+
+ public:
+  // overrides
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // constructors
+  priority_queue() = default;
+  explicit priority_queue(const Compare &compare) : compare_(compare) {}
+  priority_queue(std::initializer_list<value_type> const &items,
+                 const Compare &compare = Compare());
+  // Takes the elements of container and orders them in O(n)
+  priority_queue(const Compare &compare, container_type &&container);
+
+  // element access
+  const_reference top() const { return container_[0]; }
+  bool empty() const noexcept { return container_.empty(); }
+  size_type size() const noexcept { return container_.size(); }
+
+  // modifiers
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+  template <typename... Args>
+  void emplace(Args &&...args);
+  void pop();
+  void swap(priority_queue &other) noexcept(kNothrowSwap);
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  // Restore the heap order after the element at i got greater or
+  // smaller. Both move a hole instead of swapping.
+  void SiftUp(size_type i);
+  void SiftDown(size_type i);
+
+  container_type container_;
+  Compare compare_;
+};
+
+// A priority queue whose elements can be changed or removed after the
+// push: push() returns a handle that stays valid until the element is
+// popped or erased (then it may be given to a new element). update(),
+// decrease_key() and erase() take O(log n). This is what Dijkstra's and
+// Prim's algorithms and schedulers with changing priorities need.
+//
+// The values stay in place in a table indexed by handle; the heap
+// itself holds handles and a second table keeps the heap position of
+// each handle. An erased value stays in its slot until the handle is
+// reused or the queue is cleared.
+template <typename T, typename Compare = std::less<T>, size_t Arity = 2>
+class indexed_priority_queue {
+  static_assert(Arity >= 2, "a heap node needs at least two children");
+
+ public:
+  // overrides
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using handle = size_t;
+
+  // constructors
+  indexed_priority_queue() = default;
+  explicit indexed_priority_queue(const Compare &compare)
+      : compare_(compare) {}
+
+  // element access
+  const_reference top() const { return values_[heap_[0]]; }
+  handle top_handle() const { return heap_[0]; }
+  // The value of an element in the queue
+  const_reference operator[](handle h) const { return values_[h]; }
+  bool contains(handle h) const noexcept {
+    return h < pos_.size() && pos_[h] != kNotInHeap;
+  }
+
+  bool empty() const noexcept { return heap_.empty(); }
+  size_type size() const noexcept { return heap_.size(); }
+  // Makes room for size elements
+  void reserve(size_type size);
+
+  // modifiers
+  handle push(const_reference value) { return emplace(value); }
+  template <typename... Args>
+  handle emplace(Args &&...args);
+  void pop() { erase(heap_[0]); }
+  // Changes the value of an element in either direction
+  void update(handle h, const_reference value);
+  // Changes the value to one that doesn't come out later (for
+  // std::greater, a smaller one), which only needs a sift up
+  void decrease_key(handle h, const_reference value);
+  void erase(handle h);
+  void clear() noexcept;
+  void swap(indexed_priority_queue &other) noexcept;
+
+ private:
+  static constexpr size_type kNotInHeap = std::numeric_limits<size_t>::max();
+
+  // Comparison of the elements with handles a and b
+  bool Less(handle a, handle b) const {
+    return compare_(values_[a], values_[b]);
+  }
+  void Place(size_type i, handle h) noexcept {
+    heap_[i] = h;
+    pos_[h] = i;
+  }
+  void SiftUp(size_type i);
+  void SiftDown(size_type i);
+
+  vector<handle> heap_;
+  vector<value_type> values_;
+  vector<size_type> pos_;
+  vector<handle> free_;
+  Compare compare_;
+};
+
+// priority_queue
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    std::initializer_list<value_type> const &items, const Compare &compare)
+    : priority_queue(compare, container_type(items)) {}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    const Compare &compare, container_type &&container)
+    : container_(std::move(container)), compare_(compare) {
+  if (size() < 2) return;
+  for (size_type i = (size() - 2) / Arity + 1; i-- > 0;) SiftDown(i);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename... Args>
+void priority_queue<T, Container, Compare, Arity>::emplace(Args &&...args) {
+  container_.insert_many_back(value_type(std::forward<Args>(args)...));
+  SiftUp(size() - 1);
+}
+
+// The last element, which replaces the top, is almost always small, so
+// the hole goes all the way down along the greatest children without
+// comparing with it, and it is sifted up from the leaf (Floyd's trick:
+// about half as many comparisons as an ordinary sift down).
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::pop() {
+  size_type n = size() - 1;
+  size_type i = 0;
+  for (size_type first; (first = i * Arity + 1) < n;) {
+    size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type k = first + 1; k < last; ++k)
+      if (compare_(container_[best], container_[k])) best = k;
+    container_[i] = std::move(container_[best]);
+    i = best;
+  }
+  if (i != n) {
+    container_[i] = std::move(container_[n]);
+    SiftUp(i);
+  }
+  container_.pop_back();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::swap(
+    priority_queue &other) noexcept(kNothrowSwap) {
+  container_.swap(other.container_);
+  std::swap(compare_, other.compare_);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename... Args>
+void priority_queue<T, Container, Compare, Arity>::insert_many_back(
+    Args &&...args) {
+  (push(std::forward<Args>(args)), ...);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::SiftUp(size_type i) {
+  value_type value = std::move(container_[i]);
+  while (i > 0) {
+    size_type parent = (i - 1) / Arity;
+    if (!compare_(container_[parent], value)) break;
+    container_[i] = std::move(container_[parent]);
+    i = parent;
+  }
+  container_[i] = std::move(value);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::SiftDown(size_type i) {
+  size_type n = size();
+  if (i * Arity + 1 >= n) return;
+  value_type value = std::move(container_[i]);
+  for (size_type first; (first = i * Arity + 1) < n;) {
+    size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type k = first + 1; k < last; ++k)
+      if (compare_(container_[best], container_[k])) best = k;
+    if (!compare_(value, container_[best])) break;
+    container_[i] = std::move(container_[best]);
+    i = best;
+  }
+  container_[i] = std::move(value);
+}
+
+// indexed_priority_queue
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::reserve(size_type size) {
+  heap_.reserve(size);
+  values_.reserve(size);
+  pos_.reserve(size);
+}
+
+template <typename T, typename Compare, size_t Arity>
+template <typename... Args>
+size_t indexed_priority_queue<T, Compare, Arity>::emplace(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  handle h;
+  if (free_.empty()) {
+    h = values_.size();
+    values_.insert_many_back(std::move(value));
+    pos_.push_back(kNotInHeap);
+  } else {
+    h = free_.back();
+    values_[h] = std::move(value);
+    free_.pop_back();
+  }
+  heap_.push_back(h);
+  pos_[h] = heap_.size() - 1;
+  SiftUp(heap_.size() - 1);
+  return h;
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::update(handle h,
+                                                      const_reference value) {
+  if (!contains(h)) throw std::out_of_range("no such element in the queue");
+  bool up = compare_(values_[h], value);
+  values_[h] = value;
+  if (up)
+    SiftUp(pos_[h]);
+  else
+    SiftDown(pos_[h]);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::decrease_key(
+    handle h, const_reference value) {
+  if (!contains(h)) throw std::out_of_range("no such element in the queue");
+  values_[h] = value;
+  SiftUp(pos_[h]);
+}
+
+// Puts the last element in the place of h and sifts it the way it has
+// to go
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::erase(handle h) {
+  if (!contains(h)) throw std::out_of_range("no such element in the queue");
+  free_.push_back(h);
+  size_type i = pos_[h];
+  pos_[h] = kNotInHeap;
+  handle last = heap_[heap_.size() - 1];
+  heap_.pop_back();
+  if (last != h) {
+    Place(i, last);
+    if (i > 0 && Less(heap_[(i - 1) / Arity], last))
+      SiftUp(i);
+    else
+      SiftDown(i);
+  }
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::clear() noexcept {
+  heap_.clear();
+  values_.clear();
+  pos_.clear();
+  free_.clear();
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::swap(
+    indexed_priority_queue &other) noexcept {
+  heap_.swap(other.heap_);
+  values_.swap(other.values_);
+  pos_.swap(other.pos_);
+  free_.swap(other.free_);
+  std::swap(compare_, other.compare_);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::SiftUp(size_type i) {
+  handle h = heap_[i];
+  while (i > 0) {
+    size_type parent = (i - 1) / Arity;
+    if (!Less(heap_[parent], h)) break;
+    Place(i, heap_[parent]);
+    i = parent;
+  }
+  Place(i, h);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::SiftDown(size_type i) {
+  size_type n = heap_.size();
+  handle h = heap_[i];
+  for (size_type first; (first = i * Arity + 1) < n;) {
+    size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type k = first + 1; k < last; ++k)
+      if (Less(heap_[best], heap_[k])) best = k;
+    if (!Less(h, heap_[best])) break;
+    Place(i, heap_[best]);
+    i = best;
+  }
+  Place(i, h);
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_PRIORITY_QUEUE_PRIORITY_QUEUE_H_  // NOLINT
@@ -0,0 +1,1058 @@
+#ifndef S21_CONTAINERS_RADIX_MAP_RADIX_MAP_H_  // NOLINT
+#define S21_CONTAINERS_RADIX_MAP_RADIX_MAP_H_  // NOLINT
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif  // __SSE2__
+
+namespace s21 {
+
+// The bytes of a key for radix_map, in an order that is the order of
+// the keys. The keys must compare with operator< in the same order.
+template <typename Key, typename = void>
+struct RadixKeyTraits;
+
+template <>
+struct RadixKeyTraits<std::string> {
+  using Bytes = std::string_view;
+  static Bytes Encode(const std::string &key) noexcept { return key; }
+};
+
+// Integers go big-endian with the sign bit flipped
+template <typename Key>
+struct RadixKeyTraits<Key, std::enable_if_t<std::is_integral<Key>::value &&
+                                            !std::is_same<Key, bool>::value>> {
+  struct Bytes {
+    unsigned char operator[](size_t i) const noexcept { return data_[i]; }
+    size_t size() const noexcept { return sizeof(Key); }
+
+    unsigned char data_[sizeof(Key)];
+  };
+  static Bytes Encode(Key key) noexcept {
+    using U = std::make_unsigned_t<Key>;
+    U u = static_cast<U>(key);
+    if (std::is_signed<Key>::value) u ^= U(1) << (sizeof(Key) * 8 - 1);
+    Bytes bytes;
+    for (size_t i = sizeof(Key); i-- > 0; u = static_cast<U>(u >> 4 >> 4))
+      bytes.data_[i] = static_cast<unsigned char>(u);
+    return bytes;
+  }
+};
+
+// An ordered map in an adaptive radix tree (Leis et al., "The Adaptive
+// Radix Tree: ARTful Indexing for Main-Memory Databases"): the keys are
+// split into bytes and each inner node branches on one byte, so a
+// lookup reads every byte of the key once instead of comparing whole
+// keys at every level of a binary tree. The inner nodes come in four
+// sizes (4, 16, 48 and 256 children) and grow and shrink with their
+// number of children; a node with a single child is merged into it,
+// keeping the skipped bytes as the prefix of the node (up to
+// kMaxPrefix of them are stored, longer prefixes are read from a leaf
+// when they have to be). A subtree with a single key is just its leaf.
+//
+// The leaves are also linked in key order, so iteration, range queries
+// from lower_bound() and prefix_range() cost O(1) per element.
+//
+// Key is std::string or an integer type (see RadixKeyTraits).
+template <typename Key, typename T>
+class radix_map {
+  using Traits = RadixKeyTraits<Key>;
+  using Bytes = typename Traits::Bytes;
+  struct Leaf;
+  struct Inner;
+
+ public:
+  // Member type
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+  template <bool Const>
+  class RadixMapIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::pair<const Key, T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const value_type *, value_type *>;
+    using reference =
+        std::conditional_t<Const, const value_type &, value_type &>;
+
+    RadixMapIterator() = default;
+    // iterator converts to const_iterator
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    RadixMapIterator(const RadixMapIterator<false> &other)  // NOLINT
+        : owner_(other.owner_), leaf_(other.leaf_) {}
+
+    reference operator*() const { return leaf_->value_; }
+    pointer operator->() const { return &leaf_->value_; }
+
+    RadixMapIterator &operator++() {
+      leaf_ = leaf_->next_;
+      return *this;
+    }
+    RadixMapIterator operator++(int) {
+      RadixMapIterator tmp = *this;
+      leaf_ = leaf_->next_;
+      return tmp;
+    }
+    RadixMapIterator &operator--() {
+      leaf_ = leaf_ ? leaf_->prev_ : owner_->tail_;
+      return *this;
+    }
+    RadixMapIterator operator--(int) {
+      RadixMapIterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const RadixMapIterator &rhs) const {
+      return leaf_ == rhs.leaf_;
+    }
+    bool operator!=(const RadixMapIterator &rhs) const {
+      return leaf_ != rhs.leaf_;
+    }
+
+   private:
+    RadixMapIterator(const radix_map *owner, Leaf *leaf)
+        : owner_(owner), leaf_(leaf) {}
+
+    const radix_map *owner_ = nullptr;
+    // nullptr is the end
+    Leaf *leaf_ = nullptr;
+    friend class radix_map;
+    template <bool>
+    friend class RadixMapIterator;
+  };
+
+  using iterator = RadixMapIterator<false>;
+  using const_iterator = RadixMapIterator<true>;
+
+  // Functions
+  radix_map() = default;
+  radix_map(std::initializer_list<value_type> const &items);
+  radix_map(const radix_map &other);
+  radix_map(radix_map &&other) noexcept { swap(other); }
+  ~radix_map() { clear(); }
+  radix_map &operator=(radix_map other) noexcept;
+
+  // Element access
+  T &at(const Key &key);
+  const T &at(const Key &key) const;
+  T &operator[](const Key &key) { return try_emplace(key).first->second; }
+
+  // Iterators
+  iterator begin() noexcept { return iterator(this, head_); }
+  const_iterator begin() const noexcept { return const_iterator(this, head_); }
+  iterator end() noexcept { return iterator(this, nullptr); }
+  const_iterator end() const noexcept { return const_iterator(this, nullptr); }
+
+  // Capacity
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return (~(size_type(0))) / (sizeof(Leaf) + sizeof(Inner));
+  }
+
+  // Modifiers
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return Emplace(value.first, value);
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return try_emplace(key, obj);
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  // Inserts {key, T(args...)} if the key is absent; makes no T otherwise
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args) {
+    return Emplace(key, std::piecewise_construct, std::forward_as_tuple(key),
+                   std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  // Returns the iterator to the element after the erased one
+  iterator erase(const_iterator pos);
+  size_type erase(const Key &key);
+  void swap(radix_map &other) noexcept;
+
+  // Lookup
+  size_type count(const Key &key) const { return Find(key) ? 1 : 0; }
+  bool contains(const Key &key) const { return Find(key) != nullptr; }
+  iterator find(const Key &key) { return iterator(this, Find(key)); }
+  const_iterator find(const Key &key) const {
+    return const_iterator(this, Find(key));
+  }
+  iterator lower_bound(const Key &key) {
+    return iterator(this, LowerBound(key));
+  }
+  const_iterator lower_bound(const Key &key) const {
+    return const_iterator(this, LowerBound(key));
+  }
+  iterator upper_bound(const Key &key) {
+    return iterator(this, UpperBound(key));
+  }
+  const_iterator upper_bound(const Key &key) const {
+    return const_iterator(this, UpperBound(key));
+  }
+  // The elements whose keys start with the bytes of prefix (for string
+  // keys: the strings that start with it), in key order
+  std::pair<iterator, iterator> prefix_range(const Key &prefix);
+  std::pair<const_iterator, const_iterator> prefix_range(
+      const Key &prefix) const;
+
+ private:
+  // A child is a pointer to a leaf with the lowest bit set or a pointer
+  // to an inner node
+  using Ptr = uintptr_t;
+
+  enum NodeType : uint8_t { kNode4, kNode16, kNode48, kNode256 };
+  static constexpr uint32_t kMaxPrefix = 8;
+
+  struct Leaf {
+    template <typename... Args>
+    explicit Leaf(Args &&...args) : value_(std::forward<Args>(args)...) {}
+
+    value_type value_;
+    Leaf *prev_ = nullptr;
+    Leaf *next_ = nullptr;
+  };
+
+  struct Inner {
+    explicit Inner(NodeType type) : type_(type) {}
+
+    NodeType type_;
+    uint16_t count_ = 0;
+    uint32_t prefix_len_ = 0;
+    unsigned char prefix_[kMaxPrefix];
+    // the leaf whose key ends right after the prefix
+    Leaf *leaf_ = nullptr;
+  };
+  // The keys of the children are sorted
+  struct Node4 : Inner {
+    Node4() : Inner(kNode4) {}
+    unsigned char keys_[4];
+    Ptr children_[4];
+  };
+  struct Node16 : Inner {
+    Node16() : Inner(kNode16) {}
+    unsigned char keys_[16];
+    Ptr children_[16];
+  };
+  // index_[byte] is the slot of the child plus one, or 0; the first
+  // count_ slots are in use
+  struct Node48 : Inner {
+    Node48() : Inner(kNode48) { std::memset(index_, 0, sizeof(index_)); }
+    unsigned char index_[256];
+    Ptr children_[48] = {};
+  };
+  struct Node256 : Inner {
+    Node256() : Inner(kNode256) {}
+    Ptr children_[256] = {};
+  };
+
+  static bool IsLeaf(Ptr p) noexcept { return p & 1; }
+  static Leaf *AsLeaf(Ptr p) noexcept {
+    return reinterpret_cast<Leaf *>(p & ~Ptr(1));
+  }
+  static Inner *AsInner(Ptr p) noexcept { return reinterpret_cast<Inner *>(p); }
+  static Ptr FromLeaf(Leaf *leaf) noexcept {
+    return reinterpret_cast<Ptr>(leaf) | 1;
+  }
+  static Ptr FromInner(Inner *node) noexcept {
+    return reinterpret_cast<Ptr>(node);
+  }
+  static unsigned char Byte(const Bytes &bytes, size_t i) noexcept {
+    return static_cast<unsigned char>(bytes[i]);
+  }
+  static Bytes KeyBytes(const Leaf *leaf) noexcept {
+    return Traits::Encode(leaf->value_.first);
+  }
+
+  // Inner nodes
+  static Ptr *FindChild(Inner *node, unsigned char c) noexcept;
+  // The child with the smallest byte greater than c (c may be -1), or 0
+  static Ptr ChildAfter(Inner *node, int c) noexcept;
+  static Ptr LastChild(Inner *node) noexcept;
+  // Calls f(byte, child) for the children in order
+  template <typename F>
+  static void ForEachChild(Inner *node, F f);
+  // Adds a child to the node at *ref, growing it (and updating *ref) if
+  // it is full
+  static void AddChild(Ptr *ref, Inner *node, unsigned char c, Ptr child);
+  // Removes a child from the node at *ref and shrinks or merges it
+  static void RemoveChild(Ptr *ref, Inner *node, unsigned char c) noexcept;
+  // Brings the node at *ref to the smallest size for its children, or
+  // replaces it by its only child or leaf
+  static void Compact(Ptr *ref, Inner *node) noexcept;
+  // A node of the type with the header and the children of node, which
+  // is freed
+  static Inner *Resize(Inner *node, NodeType type);
+  static void FreeInner(Inner *node) noexcept;
+  // Frees the inner nodes of the subtree, but not the leaves
+  static void FreeInners(Ptr p) noexcept;
+
+  // Prefixes
+  static void SetPrefix(Inner *node, const Bytes &key, size_t from,
+                        uint32_t len) noexcept;
+  // The number of the bytes of the prefix of node (which starts at
+  // depth) that match key before the key ends; if that is less than the
+  // prefix, puts the prefix byte after them to *mismatch
+  static uint32_t MatchPrefix(Ptr p, const Bytes &key, size_t depth,
+                              unsigned char *mismatch) noexcept;
+
+  static Leaf *Min(Ptr p) noexcept;
+  static Leaf *Max(Ptr p) noexcept;
+
+  Leaf *Find(const Key &key) const;
+  Leaf *LowerBound(const Key &key) const;
+  Leaf *UpperBound(const Key &key) const;
+  // The subtree that holds exactly the keys that start with prefix, or 0
+  Ptr Subtree(const Key &prefix) const;
+  template <typename... Args>
+  std::pair<iterator, bool> Emplace(const Key &key, Args &&...args);
+  // Hangs the leaf, whose key isn't in the tree, in its place
+  void InsertLeaf(Leaf *leaf);
+  // Unhooks the leaf with the key from the tree and returns it
+  Leaf *RemoveLeaf(const Key &key);
+
+  Ptr root_ = 0;
+  // the leaves in key order
+  Leaf *head_ = nullptr;
+  Leaf *tail_ = nullptr;
+  size_type size_ = 0;
+};
+
+// Functions
+// The constructors delegate, so the destructor frees what a throwing
+// insert leaves behind
+template <typename Key, typename T>
+radix_map<Key, T>::radix_map(std::initializer_list<value_type> const &items)
+    : radix_map() {
+  for (const value_type &item : items) insert(item);
+}
+
+template <typename Key, typename T>
+radix_map<Key, T>::radix_map(const radix_map &other) : radix_map() {
+  for (Leaf *leaf = other.head_; leaf; leaf = leaf->next_)
+    insert(leaf->value_);
+}
+
+template <typename Key, typename T>
+radix_map<Key, T> &radix_map<Key, T>::operator=(radix_map other) noexcept {
+  swap(other);
+  return *this;
+}
+
+// Element access
+template <typename Key, typename T>
+T &radix_map<Key, T>::at(const Key &key) {
+  Leaf *leaf = Find(key);
+  if (!leaf) {
+    throw std::out_of_range("radix_map::at");
+  }
+  return leaf->value_.second;
+}
+
+template <typename Key, typename T>
+const T &radix_map<Key, T>::at(const Key &key) const {
+  Leaf *leaf = Find(key);
+  if (!leaf) {
+    throw std::out_of_range("radix_map::at");
+  }
+  return leaf->value_.second;
+}
+
+// Modifiers
+template <typename Key, typename T>
+void radix_map<Key, T>::clear() noexcept {
+  FreeInners(root_);
+  while (head_) {
+    Leaf *next = head_->next_;
+    delete head_;
+    head_ = next;
+  }
+  root_ = 0;
+  tail_ = nullptr;
+  size_ = 0;
+}
+
+template <typename Key, typename T>
+std::pair<typename radix_map<Key, T>::iterator, bool>
+radix_map<Key, T>::insert_or_assign(const Key &key, const T &obj) {
+  std::pair<iterator, bool> res = try_emplace(key, obj);
+  if (!res.second) res.first->second = obj;
+  return res;
+}
+
+template <typename Key, typename T>
+typename radix_map<Key, T>::iterator radix_map<Key, T>::erase(
+    const_iterator pos) {
+  Leaf *next = pos.leaf_->next_;
+  erase(pos.leaf_->value_.first);
+  return iterator(this, next);
+}
+
+template <typename Key, typename T>
+typename radix_map<Key, T>::size_type radix_map<Key, T>::erase(
+    const Key &key) {
+  Leaf *leaf = RemoveLeaf(key);
+  if (!leaf) return 0;
+  if (leaf->prev_)
+    leaf->prev_->next_ = leaf->next_;
+  else
+    head_ = leaf->next_;
+  if (leaf->next_)
+    leaf->next_->prev_ = leaf->prev_;
+  else
+    tail_ = leaf->prev_;
+  delete leaf;
+  --size_;
+  return 1;
+}
+
+template <typename Key, typename T>
+void radix_map<Key, T>::swap(radix_map &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+  std::swap(size_, other.size_);
+}
+
+// Lookup
+template <typename Key, typename T>
+std::pair<typename radix_map<Key, T>::iterator,
+          typename radix_map<Key, T>::iterator>
+radix_map<Key, T>::prefix_range(const Key &prefix) {
+  Ptr p = Subtree(prefix);
+  if (!p) return {end(), end()};
+  return {iterator(this, Min(p)), iterator(this, Max(p)->next_)};
+}
+
+template <typename Key, typename T>
+std::pair<typename radix_map<Key, T>::const_iterator,
+          typename radix_map<Key, T>::const_iterator>
+radix_map<Key, T>::prefix_range(const Key &prefix) const {
+  Ptr p = Subtree(prefix);
+  if (!p) return {end(), end()};
+  return {const_iterator(this, Min(p)), const_iterator(this, Max(p)->next_)};
+}
+
+// Inner nodes
+// Node16 compares all its keys with the byte at once with SSE2
+template <typename Key, typename T>
+typename radix_map<Key, T>::Ptr *radix_map<Key, T>::FindChild(
+    Inner *node, unsigned char c) noexcept {
+  switch (node->type_) {
+    case kNode4: {
+      Node4 *n = static_cast<Node4 *>(node);
+      for (int i = 0; i < n->count_; ++i)
+        if (n->keys_[i] == c) return &n->children_[i];
+      return nullptr;
+    }
+    case kNode16: {
+      Node16 *n = static_cast<Node16 *>(node);
+#ifdef __SSE2__
+      __m128i keys = _mm_loadu_si128(reinterpret_cast<__m128i *>(n->keys_));
+      __m128i eq = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(c)), keys);
+      unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(eq)) &
+                      ((1u << n->count_) - 1);
+      return mask ? &n->children_[__builtin_ctz(mask)] : nullptr;
+#else
+      for (int i = 0; i < n->count_; ++i)
+        if (n->keys_[i] == c) return &n->children_[i];
+      return nullptr;
+#endif  // __SSE2__
+    }
+    case kNode48: {
+      Node48 *n = static_cast<Node48 *>(node);
+      return n->index_[c] ? &n->children_[n->index_[c] - 1] : nullptr;
+    }
+    default: {
+      Node256 *n = static_cast<Node256 *>(node);
+      return n->children_[c] ? &n->children_[c] : nullptr;
+    }
+  }
+}
+
+template <typename Key, typename T>
+typename radix_map<Key, T>::Ptr radix_map<Key, T>::ChildAfter(
+    Inner *node, int c) noexcept {
+  switch (node->type_) {
+    case kNode4: {
+      Node4 *n = static_cast<Node4 *>(node);
+      for (int i = 0; i < n->count_; ++i)
+        if (n->keys_[i] > c) return n->children_[i];
+      return 0;
+    }
+    case kNode16: {
+      Node16 *n = static_cast<Node16 *>(node);
+      for (int i = 0; i < n->count_; ++i)
+        if (n->keys_[i] > c) return n->children_[i];
+      return 0;
+    }
+    case kNode48: {
+      Node48 *n = static_cast<Node48 *>(node);
+      for (int i = c + 1; i < 256; ++i)
+        if (n->index_[i]) return n->children_[n->index_[i] - 1];
+      return 0;
+    }
+    default: {
+      Node256 *n = static_cast<Node256 *>(node);
+      for (int i = c + 1; i < 256; ++i)
+        if (n->children_[i]) return n->children_[i];
+      return 0;
+    }
+  }
+}
+
+template <typename Key, typename T>
+typename radix_map<Key, T>::Ptr radix_map<Key, T>::LastChild(
+    Inner *node) noexcept {
+  if (!node->count_) return 0;
+  switch (node->type_) {
+    case kNode4:
+      return static_cast<Node4 *>(node)->children_[node->count_ - 1];
+    case kNode16:
+      return static_cast<Node16 *>(node)->children_[node->count_ - 1];
+    case kNode48: {
+      Node48 *n = static_cast<Node48 *>(node);
+      for (int i = 255;; --i)
+        if (n->index_[i]) return n->children_[n->index_[i] - 1];
+    }
+    default: {
+      Node256 *n = static_cast<Node256 *>(node);
+      for (int i = 255;; --i)
+        if (n->children_[i]) return n->children_[i];
+    }
+  }
+}
+
+template <typename Key, typename T>
+template <typename F>
+void radix_map<Key, T>::ForEachChild(Inner *node, F f) {
+  switch (node->type_) {
+    case kNode4: {
+      Node4 *n = static_cast<Node4 *>(node);
+      for (int i = 0; i < n->count_; ++i) f(n->keys_[i], n->children_[i]);
+      break;
+    }
+    case kNode16: {
+      Node16 *n = static_cast<Node16 *>(node);
+      for (int i = 0; i < n->count_; ++i) f(n->keys_[i], n->children_[i]);
+      break;
+    }
+    case kNode48: {
+      Node48 *n = static_cast<Node48 *>(node);
+      for (int i = 0; i < 256; ++i)
+        if (n->index_[i])
+          f(static_cast<unsigned char>(i), n->children_[n->index_[i] - 1]);
+      break;
+    }
+    default: {
+      Node256 *n = static_cast<Node256 *>(node);
+      for (int i = 0; i < 256; ++i)
+        if (n->children_[i])
+          f(static_cast<unsigned char>(i), n->children_[i]);
+    }
+  }
+}
+
+template <typename Key, typename T>
+void radix_map<Key, T>::AddChild(Ptr *ref, Inner *node, unsigned char c,
+                                 Ptr child) {
+  switch (node->type_) {
+    case kNode4:
+    case kNode16: {
+      int capacity = node->type_ == kNode4 ? 4 : 16;
+      if (node->count_ == capacity) {
+        node = Resize(node, node->type_ == kNode4 ? kNode16 : kNode48);
+        *ref = FromInner(node);
+        return AddChild(ref, node, c, child);
+      }
+      unsigned char *keys = node->type_ == kNode4
+                                ? static_cast<Node4 *>(node)->keys_
+                                : static_cast<Node16 *>(node)->keys_;
+      Ptr *children = node->type_ == kNode4
+                          ? static_cast<Node4 *>(node)->children_
+                          : static_cast<Node16 *>(node)->children_;
+      int i = node->count_;
+      for (; i > 0 && keys[i - 1] > c; --i) {
+        keys[i] = keys[i - 1];
+        children[i] = children[i - 1];
+      }
+      keys[i] = c;
+      children[i] = child;
+      break;
+    }
+    case kNode48: {
+      Node48 *n = static_cast<Node48 *>(node);
+      if (n->count_ == 48) {
+        node = Resize(node, kNode256);
+        *ref = FromInner(node);
+        return AddChild(ref, node, c, child);
+      }
+      n->children_[n->count_] = child;
+      n->index_[c] = static_cast<unsigned char>(n->count_ + 1);
+      break;
+    }
+    default:
+      static_cast<Node256 *>(node)->children_[c] = child;
+  }
+  ++node->count_;
+}
+
+template <typename Key, typename T>
+void radix_map<Key, T>::RemoveChild(Ptr *ref, Inner *node,
+                                    unsigned char c) noexcept {
+  switch (node->type_) {
+    case kNode4:
+    case kNode16: {
+      unsigned char *keys = node->type_ == kNode4
+                                ? static_cast<Node4 *>(node)->keys_
+                                : static_cast<Node16 *>(node)->keys_;
+      Ptr *children = node->type_ == kNode4
+                          ? static_cast<Node4 *>(node)->children_
+                          : static_cast<Node16 *>(node)->children_;
+      int i = 0;
+      while (keys[i] != c) ++i;
+      for (; i + 1 < node->count_; ++i) {
+        keys[i] = keys[i + 1];
+        children[i] = children[i + 1];
+      }
+      break;
+    }
+    case kNode48: {
+      // the last slot moves to the freed one
+      Node48 *n = static_cast<Node48 *>(node);
+      int slot = n->index_[c] - 1;
+      int last = n->count_ - 1;
+      n->index_[c] = 0;
+      if (slot != last) {
+        n->children_[slot] = n->children_[last];
+        for (int i = 0; i < 256; ++i)
+          if (n->index_[i] == last + 1)
+            n->index_[i] = static_cast<unsigned char>(slot + 1);
+      }
+      n->children_[last] = 0;
+      break;
+    }
+    default:
+      static_cast<Node256 *>(node)->children_[c] = 0;
+  }
+  --node->count_;
+  Compact(ref, node);
+}
+
+template <typename Key, typename T>
+void radix_map<Key, T>::Compact(Ptr *ref, Inner *node) noexcept {
+  if (node->count_ == 0) {
+    *ref = node->leaf_ ? FromLeaf(node->leaf_) : 0;
+    FreeInner(node);
+  } else if (node->count_ == 1 && !node->leaf_) {
+    // the node goes, its prefix and byte go in front of the child's
+    // prefix
+    unsigned char c = 0;
+    Ptr child = 0;
+    ForEachChild(node, [&c, &child](unsigned char b, Ptr p) {
+      c = b;
+      child = p;
+    });
+    if (!IsLeaf(child)) {
+      Inner *next = AsInner(child);
+      unsigned char prefix[kMaxPrefix];
+      uint32_t n = 0;
+      for (uint32_t i = 0; i < node->prefix_len_ && n < kMaxPrefix; ++i)
+        prefix[n++] = node->prefix_[i];
+      if (n < kMaxPrefix) prefix[n++] = c;
+      for (uint32_t i = 0; i < next->prefix_len_ && n < kMaxPrefix; ++i)
+        prefix[n++] = next->prefix_[i];
+      std::memcpy(next->prefix_, prefix, n);
+      next->prefix_len_ += node->prefix_len_ + 1;
+    }
+    *ref = child;
+    FreeInner(node);
+  } else if ((node->type_ == kNode16 && node->count_ <= 3) ||
+             (node->type_ == kNode48 && node->count_ <= 12) ||
+             (node->type_ == kNode256 && node->count_ <= 37)) {
+    // one size down, with some slack so that a node at the edge doesn't
+    // flip on every insertion and erasure
+    NodeType smaller = static_cast<NodeType>(node->type_ - 1);
+    try {
+      *ref = FromInner(Resize(node, smaller));
+    } catch (...) {
+      // the bigger node just stays
+    }
+  }
+}
+
+template <typename Key, typename T>
+typename radix_map<Key, T>::Inner *radix_map<Key, T>::Resize(Inner *node,
+                                                             NodeType type) {
+  Inner *resized;
+  switch (type) {
+    case kNode4:
+      resized = new Node4;
+      break;
+    case kNode16:
+      resized = new Node16;
+      break;
+    case kNode48:
+      resized = new Node48;
+      break;
+    default:
+      resized = new Node256;
+  }
+  resized->prefix_len_ = node->prefix_len_;
+  std::memcpy(resized->prefix_, node->prefix_, kMaxPrefix);
+  resized->leaf_ = node->leaf_;
+  Ptr ref = FromInner(resized);
+  ForEachChild(node, [&ref, resized](unsigned char c, Ptr child) {
+    AddChild(&ref, resized, c, child);
+  });
+  FreeInner(node);
+  return resized;
+}
+
+template <typename Key, typename T>
+void radix_map<Key, T>::FreeInner(Inner *node) noexcept {
+  switch (node->type_) {
+    case kNode4:
+      delete static_cast<Node4 *>(node);
+      break;
+    case kNode16:
+      delete static_cast<Node16 *>(node);
+      break;
+    case kNode48:
+      delete static_cast<Node48 *>(node);
+      break;
+    default:
+      delete static_cast<Node256 *>(node);
+  }
+}
+
+// The depth of the recursion is bounded by the length of the keys
+template <typename Key, typename T>
+void radix_map<Key, T>::FreeInners(Ptr p) noexcept {
+  if (!p || IsLeaf(p)) return;
+  ForEachChild(AsInner(p), [](unsigned char, Ptr child) { FreeInners(child); });
+  FreeInner(AsInner(p));
+}
+
+// Prefixes
+template <typename Key, typename T>
+void radix_map<Key, T>::SetPrefix(Inner *node, const Bytes &key, size_t from,
+                                  uint32_t len) noexcept {
+  node->prefix_len_ = len;
+  for (uint32_t i = 0; i < len && i < kMaxPrefix; ++i)
+    node->prefix_[i] = Byte(key, from + i);
+}
+
+template <typename Key, typename T>
+uint32_t radix_map<Key, T>::MatchPrefix(Ptr p, const Bytes &key, size_t depth,
+                                        unsigned char *mismatch) noexcept {
+  Inner *node = AsInner(p);
+  uint32_t len = node->prefix_len_;
+  uint32_t i = 0;
+  for (; i < len && i < kMaxPrefix; ++i) {
+    *mismatch = node->prefix_[i];
+    if (depth + i == key.size() || *mismatch != Byte(key, depth + i))
+      return i;
+  }
+  if (i == len) return i;
+  // the rest of the prefix is in the keys of all the leaves below
+  Bytes full = KeyBytes(Min(p));
+  for (; i < len; ++i) {
+    *mismatch = Byte(full, depth + i);
+    if (depth + i == key.size() || *mismatch != Byte(key, depth + i))
+      return i;
+  }
+  return i;
+}
+
+template <typename Key, typename T>
+typename radix_map<Key, T>::Leaf *radix_map<Key, T>::Min(Ptr p) noexcept {
+  while (!IsLeaf(p)) {
+    Inner *node = AsInner(p);
+    if (node->leaf_) return node->leaf_;
+    p = ChildAfter(node, -1);
+  }
+  return AsLeaf(p);
+}
+
+template <typename Key, typename T>
+typename radix_map<Key, T>::Leaf *radix_map<Key, T>::Max(Ptr p) noexcept {
+  while (!IsLeaf(p)) {
+    Inner *node = AsInner(p);
+    if (!node->count_) return node->leaf_;
+    p = LastChild(node);
+  }
+  return AsLeaf(p);
+}
+
+// Only the stored bytes of long prefixes are checked on the way down;
+// the key of the leaf is compared in full in the end
+template <typename Key, typename T>
+typename radix_map<Key, T>::Leaf *radix_map<Key, T>::Find(
+    const Key &key) const {
+  Bytes bytes = Traits::Encode(key);
+  size_t depth = 0;
+  for (Ptr p = root_; p;) {
+    if (IsLeaf(p)) {
+      Leaf *leaf = AsLeaf(p);
+      return leaf->value_.first == key ? leaf : nullptr;
+    }
+    Inner *node = AsInner(p);
+    for (uint32_t i = 0; i < node->prefix_len_ && i < kMaxPrefix; ++i) {
+      if (depth + i >= bytes.size() ||
+          node->prefix_[i] != Byte(bytes, depth + i))
+        return nullptr;
+    }
+    depth += node->prefix_len_;
+    if (depth >= bytes.size()) {
+      Leaf *leaf = node->leaf_;
+      return leaf && depth == bytes.size() && leaf->value_.first == key
+                 ? leaf
+                 : nullptr;
+    }
+    Ptr *child = FindChild(node, Byte(bytes, depth++));
+    p = child ? *child : 0;
+  }
+  return nullptr;
+}
+
+// Goes down along the key; where the key leaves the tree, the answer is
+// the smallest leaf of the next subtree, or the leaf after the largest
+// one of the current subtree
+template <typename Key, typename T>
+typename radix_map<Key, T>::Leaf *radix_map<Key, T>::LowerBound(
+    const Key &key) const {
+  Bytes bytes = Traits::Encode(key);
+  size_t depth = 0;
+  for (Ptr p = root_; p;) {
+    if (IsLeaf(p)) {
+      Leaf *leaf = AsLeaf(p);
+      return leaf->value_.first < key ? leaf->next_ : leaf;
+    }
+    Inner *node = AsInner(p);
+    if (node->prefix_len_) {
+      unsigned char prefix_byte = 0;
+      uint32_t matched = MatchPrefix(p, bytes, depth, &prefix_byte);
+      if (matched < node->prefix_len_) {
+        if (depth + matched == bytes.size() ||
+            Byte(bytes, depth + matched) < prefix_byte)
+          return Min(p);
+        return Max(p)->next_;
+      }
+      depth += node->prefix_len_;
+    }
+    if (depth == bytes.size()) return node->leaf_ ? node->leaf_ : Min(p);
+    unsigned char c = Byte(bytes, depth++);
+    if (Ptr *child = FindChild(node, c)) {
+      p = *child;
+    } else {
+      Ptr next = ChildAfter(node, c);
+      return next ? Min(next) : Max(p)->next_;
+    }
+  }
+  return nullptr;
+}
+
+template <typename Key, typename T>
+typename radix_map<Key, T>::Leaf *radix_map<Key, T>::UpperBound(
+    const Key &key) const {
+  Leaf *leaf = LowerBound(key);
+  return leaf && !(key < leaf->value_.first) ? leaf->next_ : leaf;
+}
+
+template <typename Key, typename T>
+typename radix_map<Key, T>::Ptr radix_map<Key, T>::Subtree(
+    const Key &prefix) const {
+  Bytes bytes = Traits::Encode(prefix);
+  size_t depth = 0;
+  for (Ptr p = root_; p;) {
+    if (depth == bytes.size()) return p;
+    if (IsLeaf(p)) {
+      Bytes leaf_bytes = KeyBytes(AsLeaf(p));
+      if (leaf_bytes.size() < bytes.size()) return 0;
+      for (size_t i = depth; i < bytes.size(); ++i)
+        if (Byte(leaf_bytes, i) != Byte(bytes, i)) return 0;
+      return p;
+    }
+    Inner *node = AsInner(p);
+    unsigned char prefix_byte = 0;
+    uint32_t matched = MatchPrefix(p, bytes, depth, &prefix_byte);
+    if (depth + matched == bytes.size()) return p;
+    if (matched < node->prefix_len_) return 0;
+    depth += node->prefix_len_;
+    Ptr *child = FindChild(node, Byte(bytes, depth++));
+    p = child ? *child : 0;
+  }
+  return 0;
+}
+
+// The new leaf goes before the first greater one in the list
+template <typename Key, typename T>
+template <typename... Args>
+std::pair<typename radix_map<Key, T>::iterator, bool>
+radix_map<Key, T>::Emplace(const Key &key, Args &&...args) {
+  Leaf *next = LowerBound(key);
+  if (next && !(key < next->value_.first)) return {iterator(this, next), false};
+  Leaf *leaf = new Leaf(std::forward<Args>(args)...);
+  try {
+    InsertLeaf(leaf);
+  } catch (...) {
+    delete leaf;
+    throw;
+  }
+  leaf->next_ = next;
+  leaf->prev_ = next ? next->prev_ : tail_;
+  if (leaf->prev_)
+    leaf->prev_->next_ = leaf;
+  else
+    head_ = leaf;
+  if (next)
+    next->prev_ = leaf;
+  else
+    tail_ = leaf;
+  ++size_;
+  return {iterator(this, leaf), true};
+}
+
+// Every new node is allocated before the tree changes, so a failed
+// allocation leaves it as it was
+template <typename Key, typename T>
+void radix_map<Key, T>::InsertLeaf(Leaf *leaf) {
+  Bytes bytes = KeyBytes(leaf);
+  Ptr *ref = &root_;
+  size_t depth = 0;
+  // hangs a leaf under a new node at the byte at i
+  auto attach = [](Ptr *ref, Inner *node, const Bytes &key, size_t i,
+                   Leaf *l) {
+    if (i == key.size())
+      node->leaf_ = l;
+    else
+      AddChild(ref, node, Byte(key, i), FromLeaf(l));
+  };
+  for (;;) {
+    Ptr p = *ref;
+    if (!p) {
+      *ref = FromLeaf(leaf);
+      return;
+    }
+    if (IsLeaf(p)) {
+      // a node for the common bytes with the two leaves under it
+      Leaf *old = AsLeaf(p);
+      Bytes old_bytes = KeyBytes(old);
+      size_t i = depth;
+      while (i < bytes.size() && i < old_bytes.size() &&
+             Byte(bytes, i) == Byte(old_bytes, i))
+        ++i;
+      Inner *node = new Node4;
+      SetPrefix(node, bytes, depth, static_cast<uint32_t>(i - depth));
+      Ptr split = FromInner(node);
+      attach(&split, node, old_bytes, i, old);
+      attach(&split, node, bytes, i, leaf);
+      *ref = split;
+      return;
+    }
+    Inner *node = AsInner(p);
+    if (node->prefix_len_) {
+      unsigned char prefix_byte = 0;
+      uint32_t matched = MatchPrefix(p, bytes, depth, &prefix_byte);
+      if (matched < node->prefix_len_) {
+        // a node for the matched part of the prefix; the old node keeps
+        // the part after the mismatching byte
+        Inner *top = new Node4;
+        SetPrefix(top, bytes, depth, matched);
+        uint32_t rest = node->prefix_len_ - matched - 1;
+        if (node->prefix_len_ <= kMaxPrefix) {
+          std::memmove(node->prefix_, node->prefix_ + matched + 1, rest);
+        } else {
+          Bytes full = KeyBytes(Min(p));
+          for (uint32_t i = 0; i < rest && i < kMaxPrefix; ++i)
+            node->prefix_[i] = Byte(full, depth + matched + 1 + i);
+        }
+        node->prefix_len_ = rest;
+        Ptr split = FromInner(top);
+        AddChild(&split, top, prefix_byte, p);
+        attach(&split, top, bytes, depth + matched, leaf);
+        *ref = split;
+        return;
+      }
+      depth += node->prefix_len_;
+    }
+    if (depth == bytes.size()) {
+      node->leaf_ = leaf;
+      return;
+    }
+    Ptr *child = FindChild(node, Byte(bytes, depth));
+    if (!child) {
+      AddChild(ref, node, Byte(bytes, depth), FromLeaf(leaf));
+      return;
+    }
+    ref = child;
+    ++depth;
+  }
+}
+
+template <typename Key, typename T>
+typename radix_map<Key, T>::Leaf *radix_map<Key, T>::RemoveLeaf(
+    const Key &key) {
+  Bytes bytes = Traits::Encode(key);
+  Ptr *ref = &root_;
+  Ptr *parent_ref = nullptr;
+  Inner *parent = nullptr;
+  unsigned char parent_byte = 0;
+  size_t depth = 0;
+  for (;;) {
+    Ptr p = *ref;
+    if (!p) return nullptr;
+    if (IsLeaf(p)) {
+      Leaf *leaf = AsLeaf(p);
+      if (!(leaf->value_.first == key)) return nullptr;
+      if (parent)
+        RemoveChild(parent_ref, parent, parent_byte);
+      else
+        root_ = 0;
+      return leaf;
+    }
+    Inner *node = AsInner(p);
+    for (uint32_t i = 0; i < node->prefix_len_ && i < kMaxPrefix; ++i) {
+      if (depth + i >= bytes.size() ||
+          node->prefix_[i] != Byte(bytes, depth + i))
+        return nullptr;
+    }
+    depth += node->prefix_len_;
+    if (depth >= bytes.size()) {
+      Leaf *leaf = node->leaf_;
+      if (!leaf || depth != bytes.size() || !(leaf->value_.first == key))
+        return nullptr;
+      node->leaf_ = nullptr;
+      Compact(ref, node);
+      return leaf;
+    }
+    Ptr *child = FindChild(node, Byte(bytes, depth));
+    if (!child) return nullptr;
+    parent_ref = ref;
+    parent = node;
+    parent_byte = Byte(bytes, depth++);
+    ref = child;
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_RADIX_MAP_RADIX_MAP_H_  // NOLINT
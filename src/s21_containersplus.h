@@ -2,6 +2,23 @@
 #define S21_CONTAINERS_S21_CONTAINERSPLUS_H_  // NOLINT
 
 #include "array/s21_array.h"
+#include "bloom_filter/s21_bloom_filter.h"
+#include "concurrent_stack/s21_concurrent_stack.h"
+#include "filtered_map/s21_filtered_map.h"
+#include "intrusive_list/s21_intrusive_list.h"
+#include "intrusive_map/s21_intrusive_map.h"
+#include "intrusive_set/s21_intrusive_set.h"
+#include "mapped_vector/s21_mapped_vector.h"
 #include "multiset/s21_multiset.h"
+#include "persistent_map/s21_persistent_map.h"
+#include "persistent_set/s21_persistent_set.h"
+#include "priority_queue/s21_priority_queue.h"
+#include "radix_map/s21_radix_map.h"
+#include "serialization/s21_serialization.h"
+#include "skiplist_map/s21_skiplist_map.h"
+#include "skiplist_set/s21_skiplist_set.h"
+#include "small_vector/s21_small_vector.h"
+#include "static_vector/s21_static_vector.h"
+#include "unrolled_list/s21_unrolled_list.h"
 
 #endif  // S21_CONTAINERS_S21_CONTAINERSPLUS_H_  // NOLINT
@@ -0,0 +1,349 @@
+// Binary serialization of the containers.
+//
+// The format is compact and portable: numbers are little-endian with a
+// fixed width, lengths are 64-bit, a string or a container is its
+// length followed by its elements, a pair is its two members. Elements
+// of the other trivially copyable types are stored as the bytes of the
+// object, so their layout has to be the same on both ends. There are
+// no headers, and containers of the supported types nest freely.
+//
+// Arrays of numbers (and of the other trivially copyable types) are
+// written and read with a single copy. Sets, multisets and maps are
+// written in order and loaded with assign_sorted(), which builds the
+// tree in O(n) instead of inserting and rebalancing element by element.
+
+#ifndef S21_CONTAINERS_SERIALIZATION_SERIALIZATION_H_  // NOLINT
+#define S21_CONTAINERS_SERIALIZATION_SERIALIZATION_H_  // NOLINT
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "list/s21_list.h"
+#include "map/s21_map.h"
+#include "multiset/s21_multiset.h"
+#include "set/s21_set.h"
+#include "vector/s21_vector.h"
+
+namespace s21 {
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+inline constexpr bool kHostIsLittleEndian = false;
+#else
+inline constexpr bool kHostIsLittleEndian = true;
+#endif
+
+// Where serialize() puts the bytes: a stream or the end of a buffer.
+class BinaryWriter {
+ public:
+  explicit BinaryWriter(std::ostream &out) : out_(&out) {}
+  explicit BinaryWriter(vector<unsigned char> *buffer) : buffer_(buffer) {}
+
+  void Write(const void *data, size_t n) {
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    if (out_) {
+      out_->write(reinterpret_cast<const char *>(bytes), n);
+      if (!*out_) throw std::runtime_error("serialize: write failed");
+    } else {
+      buffer_->insert(buffer_->end(), bytes, bytes + n);
+    }
+  }
+
+ private:
+  std::ostream *out_ = nullptr;
+  vector<unsigned char> *buffer_ = nullptr;
+};
+
+// Where deserialize() takes the bytes from: a stream or a buffer.
+class BinaryReader {
+ public:
+  explicit BinaryReader(std::istream &in) : in_(&in) {}
+  BinaryReader(const void *data, size_t size)
+      : data_(static_cast<const unsigned char *>(data)), size_(size) {}
+
+  void Read(void *dst, size_t n) {
+    if (in_) {
+      in_->read(static_cast<char *>(dst), n);
+      if (static_cast<size_t>(in_->gcount()) != n) Truncated();
+    } else {
+      if (n > size_ - pos_) Truncated();
+      std::memcpy(dst, data_ + pos_, n);
+      pos_ += n;
+    }
+  }
+
+  // Bytes left in the buffer; unknown (the maximum) for a stream
+  size_t Remaining() const noexcept {
+    return in_ ? std::numeric_limits<size_t>::max() : size_ - pos_;
+  }
+
+  size_t consumed() const noexcept { return pos_; }
+
+  [[noreturn]] static void Truncated() {
+    throw std::runtime_error("deserialize: unexpected end of data");
+  }
+
+ private:
+  std::istream *in_ = nullptr;
+  const unsigned char *data_ = nullptr;
+  size_t size_ = 0;
+  size_t pos_ = 0;
+};
+
+// BinaryCodec<T> writes and reads one T. kBulk tells that an array of
+// T is stored as the bytes of the array.
+template <typename T, typename = void>
+struct BinaryCodec;
+
+template <typename T>
+struct IsPair : std::false_type {};
+template <typename A, typename B>
+struct IsPair<std::pair<A, B>> : std::true_type {};
+
+// Numbers and enums: little-endian
+template <typename T>
+struct BinaryCodec<T, std::enable_if_t<std::is_arithmetic<T>::value ||
+                                       std::is_enum<T>::value>> {
+  static constexpr bool kBulk = kHostIsLittleEndian || sizeof(T) == 1;
+
+  static void Write(BinaryWriter *w, const T &value) {
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    if (!kHostIsLittleEndian) std::reverse(bytes, bytes + sizeof(T));
+    w->Write(bytes, sizeof(T));
+  }
+
+  static T Read(BinaryReader *r) {
+    unsigned char bytes[sizeof(T)];
+    r->Read(bytes, sizeof(T));
+    if (!kHostIsLittleEndian) std::reverse(bytes, bytes + sizeof(T));
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+  }
+};
+
+// Any other trivially copyable type: the bytes of the object
+template <typename T>
+struct BinaryCodec<
+    T, std::enable_if_t<std::is_trivially_copyable<T>::value &&
+                        !std::is_arithmetic<T>::value &&
+                        !std::is_enum<T>::value && !IsPair<T>::value>> {
+  static constexpr bool kBulk = true;
+
+  static void Write(BinaryWriter *w, const T &value) {
+    w->Write(&value, sizeof(T));
+  }
+
+  static T Read(BinaryReader *r) {
+    T value;
+    r->Read(&value, sizeof(T));
+    return value;
+  }
+};
+
+// Lengths of strings and containers
+inline void WriteLength(BinaryWriter *w, size_t n) {
+  BinaryCodec<uint64_t>::Write(w, n);
+}
+
+// Rejects a length that can't be right (more elements than there are
+// bytes left), so corrupted data never causes a huge allocation.
+inline size_t ReadLength(BinaryReader *r, size_t min_element_size) {
+  uint64_t n = BinaryCodec<uint64_t>::Read(r);
+  if (n > r->Remaining() / min_element_size) BinaryReader::Truncated();
+  return n;
+}
+
+// The number of elements read at once, so that a stream with a corrupt
+// length fails before allocating the memory the length asks for.
+inline constexpr size_t kReadChunk = size_t(1) << 16;
+
+// Writes n elements from first
+template <typename T, typename It>
+void WriteElements(BinaryWriter *w, It first, size_t n) {
+  WriteLength(w, n);
+  for (size_t i = 0; i < n; ++i, ++first) BinaryCodec<T>::Write(w, *first);
+}
+
+// Reads a length and the elements into *out
+template <typename T>
+void ReadElements(BinaryReader *r, std::vector<T> *out) {
+  size_t n = ReadLength(r, BinaryCodec<T>::kBulk ? sizeof(T) : 1);
+  out->clear();
+  if constexpr (BinaryCodec<T>::kBulk) {
+    for (size_t done = 0; done < n;) {
+      size_t chunk = std::min(n - done, kReadChunk);
+      out->resize(done + chunk);
+      r->Read(out->data() + done, chunk * sizeof(T));
+      done += chunk;
+    }
+  } else {
+    out->reserve(std::min(n, kReadChunk));
+    for (size_t i = 0; i < n; ++i) out->push_back(BinaryCodec<T>::Read(r));
+  }
+}
+
+template <>
+struct BinaryCodec<std::string> {
+  static constexpr bool kBulk = false;
+
+  static void Write(BinaryWriter *w, const std::string &value) {
+    WriteLength(w, value.size());
+    w->Write(value.data(), value.size());
+  }
+
+  static std::string Read(BinaryReader *r) {
+    size_t n = ReadLength(r, 1);
+    std::string value;
+    for (size_t done = 0; done < n;) {
+      size_t chunk = std::min(n - done, kReadChunk);
+      value.resize(done + chunk);
+      r->Read(value.data() + done, chunk);
+      done += chunk;
+    }
+    return value;
+  }
+};
+
+// The elements of a map
+template <typename A, typename B>
+struct BinaryCodec<std::pair<A, B>> {
+  static constexpr bool kBulk = false;
+  using First = BinaryCodec<std::remove_const_t<A>>;
+  using Second = BinaryCodec<std::remove_const_t<B>>;
+
+  static void Write(BinaryWriter *w, const std::pair<A, B> &value) {
+    First::Write(w, value.first);
+    Second::Write(w, value.second);
+  }
+
+  // The members of a braced list are read in order
+  static std::pair<A, B> Read(BinaryReader *r) {
+    return std::pair<A, B>{First::Read(r), Second::Read(r)};
+  }
+};
+
+template <typename T, typename Growth>
+struct BinaryCodec<vector<T, Growth>> {
+  static constexpr bool kBulk = false;
+
+  static void Write(BinaryWriter *w, const vector<T, Growth> &value) {
+    if constexpr (BinaryCodec<T>::kBulk) {
+      WriteLength(w, value.size());
+      w->Write(value.begin(), value.size() * sizeof(T));
+    } else {
+      WriteElements<T>(w, value.begin(), value.size());
+    }
+  }
+
+  static vector<T, Growth> Read(BinaryReader *r) {
+    vector<T, Growth> value;
+    size_t n = ReadLength(r, BinaryCodec<T>::kBulk ? sizeof(T) : 1);
+    if constexpr (BinaryCodec<T>::kBulk) {
+      for (size_t done = 0; done < n;) {
+        size_t chunk = std::min(n - done, kReadChunk);
+        value.resize(done + chunk);
+        r->Read(value.begin() + done, chunk * sizeof(T));
+        done += chunk;
+      }
+    } else {
+      value.reserve(std::min(n, kReadChunk));
+      for (size_t i = 0; i < n; ++i) value.push_back(BinaryCodec<T>::Read(r));
+    }
+    return value;
+  }
+};
+
+template <typename T>
+struct BinaryCodec<list<T>> {
+  static constexpr bool kBulk = false;
+
+  // list has no const iteration, but nothing here changes it
+  static void Write(BinaryWriter *w, const list<T> &value) {
+    list<T> &l = const_cast<list<T> &>(value);
+    WriteElements<T>(w, l.begin(), l.size());
+  }
+
+  static list<T> Read(BinaryReader *r) {
+    list<T> value;
+    size_t n = ReadLength(r, BinaryCodec<T>::kBulk ? sizeof(T) : 1);
+    for (size_t i = 0; i < n; ++i) value.push_back(BinaryCodec<T>::Read(r));
+    return value;
+  }
+};
+
+// Sets, multisets and maps: the elements in order, loaded with
+// assign_sorted(); data out of order are rejected with
+// std::invalid_argument.
+template <typename Tree, typename Element>
+struct TreeBinaryCodec {
+  static constexpr bool kBulk = false;
+
+  static void Write(BinaryWriter *w, const Tree &value) {
+    WriteElements<Element>(w, value.begin(), value.size());
+  }
+
+  static Tree Read(BinaryReader *r) {
+    std::vector<Element> elements;
+    ReadElements(r, &elements);
+    Tree value;
+    value.assign_sorted(std::make_move_iterator(elements.begin()),
+                        std::make_move_iterator(elements.end()));
+    return value;
+  }
+};
+
+template <typename T, typename Compare>
+struct BinaryCodec<set<T, Compare>> : TreeBinaryCodec<set<T, Compare>, T> {};
+
+template <typename T, typename Compare>
+struct BinaryCodec<multiset<T, Compare>>
+    : TreeBinaryCodec<multiset<T, Compare>, T> {};
+
+template <typename K, typename T, typename Compare>
+struct BinaryCodec<map<K, T, Compare>>
+    : TreeBinaryCodec<map<K, T, Compare>, std::pair<K, T>> {};
+
+// Writes value to out
+template <typename T>
+void serialize(const T &value, std::ostream &out) {
+  BinaryWriter w(out);
+  BinaryCodec<T>::Write(&w, value);
+}
+
+// Appends value to the end of buffer
+template <typename T>
+void serialize(const T &value, vector<unsigned char> *buffer) {
+  BinaryWriter w(buffer);
+  BinaryCodec<T>::Write(&w, value);
+}
+
+// Reads a value written by serialize() from in into *value. Throws
+// std::runtime_error if the data end too early.
+template <typename T>
+void deserialize(std::istream &in, T *value) {
+  BinaryReader r(in);
+  *value = BinaryCodec<T>::Read(&r);
+}
+
+// The same from size bytes at data; returns the number of bytes read.
+template <typename T>
+size_t deserialize(const void *data, size_t size, T *value) {
+  BinaryReader r(data, size);
+  *value = BinaryCodec<T>::Read(&r);
+  return r.consumed();
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SERIALIZATION_SERIALIZATION_H_  // NOLINT
@@ -9,17 +9,20 @@
 
 namespace s21 {
 
-template <typename T>
-class set : public BinaryTree<T, T> {
+template <typename T, typename Compare = std::less<T>>
+class set : public BinaryTree<T, T, Compare> {
  public:
   // Member type
   using key_type = T;
   using value_type = T;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = ConstBinaryTreeIterator<T, T>;
-  using const_iterator = ConstBinaryTreeIterator<T, T>;
+  using iterator = ConstBinaryTreeIterator<T, T, Compare>;
+  using const_iterator = ConstBinaryTreeIterator<T, T, Compare>;
   using size_type = size_t;
+  using node_type = TreeNodeHandle<value_type>;
+  using insert_return_type =
+      typename BinaryTree<T, T, Compare>::insert_return_type;
 
   // Functions
   set() = default;
@@ -29,65 +32,96 @@ class set : public BinaryTree<T, T> {
   ~set();
   set &operator=(set other);
 
+  // Deep copy made by n_threads threads
+  set copy_parallel(unsigned n_threads) const;
+
   // Iterators
-  using BinaryTree<T, T>::begin;
-  using BinaryTree<T, T>::end;
+  using BinaryTree<T, T, Compare>::begin;
+  using BinaryTree<T, T, Compare>::end;
 
   // Capacity
-  using BinaryTree<T, T>::empty;
-  using BinaryTree<T, T>::size;
-  using BinaryTree<T, T>::max_size;
+  using BinaryTree<T, T, Compare>::empty;
+  using BinaryTree<T, T, Compare>::size;
+  using BinaryTree<T, T, Compare>::max_size;
 
   // Modifiers
-  using BinaryTree<T, T>::clear;
-  using BinaryTree<T, T>::insert;
-  using BinaryTree<T, T>::erase;
-  using BinaryTree<T, T>::swap;
-  using BinaryTree<T, T>::merge;
+  using BinaryTree<T, T, Compare>::clear;
+  using BinaryTree<T, T, Compare>::emplace;
+  using BinaryTree<T, T, Compare>::emplace_hint;
+  using BinaryTree<T, T, Compare>::insert;
+  using BinaryTree<T, T, Compare>::erase;
+  using BinaryTree<T, T, Compare>::erase_above;
+  using BinaryTree<T, T, Compare>::erase_below;
+  using BinaryTree<T, T, Compare>::erase_if;
+  using BinaryTree<T, T, Compare>::extract;
+  using BinaryTree<T, T, Compare>::swap;
+  using BinaryTree<T, T, Compare>::merge;
+  using BinaryTree<T, T, Compare>::assign_sorted;
 
   // Lookup
-  using BinaryTree<T, T>::find;
-  using BinaryTree<T, T>::contains;
+  using BinaryTree<T, T, Compare>::count;
+  using BinaryTree<T, T, Compare>::find;
+  using BinaryTree<T, T, Compare>::contains;
+  using BinaryTree<T, T, Compare>::equal_range;
+  using BinaryTree<T, T, Compare>::lower_bound;
+  using BinaryTree<T, T, Compare>::upper_bound;
+  using BinaryTree<T, T, Compare>::overlapping;
+  using BinaryTree<T, T, Compare>::stabbing;
 
   // Bonus task
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(const Args &&...args);
 
+  // Parallelism
+  using BinaryTree<T, T, Compare>::set_parallel_destruction;
+
   // Debug
-  using BinaryTree<T, T>::print;
+  using BinaryTree<T, T, Compare>::print;
+
+ private:
+  set(const set &other, unsigned n_threads);
 };
 
 // Functions
-template <typename T>
-set<T>::set(std::initializer_list<value_type> const &items) {
+template <typename T, typename Compare>
+set<T, Compare>::set(std::initializer_list<value_type> const &items) {
   for (auto item : items) {
     insert(item);
   }
 }
 
-template <typename T>
-set<T>::set(const set &other) : BinaryTree<T, T>(other) {}
+template <typename T, typename Compare>
+set<T, Compare>::set(const set &other) : BinaryTree<T, T, Compare>(other) {}
 
-template <typename T>
-set<T>::set(set &&other) noexcept {
+template <typename T, typename Compare>
+set<T, Compare>::set(const set &other, unsigned n_threads)
+    : BinaryTree<T, T, Compare>(other, n_threads) {}
+
+template <typename T, typename Compare>
+set<T, Compare>::set(set &&other) noexcept {
   swap(other);
 }
 
-template <typename T>
-set<T>::~set() {}
+template <typename T, typename Compare>
+set<T, Compare>::~set() {}
 
-template <typename T>
-set<T> &set<T>::operator=(set<T> other) {
+template <typename T, typename Compare>
+set<T, Compare> &set<T, Compare>::operator=(set<T, Compare> other) {
   swap(other);
   return *this;
 }
 
+template <typename T, typename Compare>
+set<T, Compare> set<T, Compare>::copy_parallel(unsigned n_threads) const {
+  return set<T, Compare>(*this, n_threads);
+}
+
 // Bonus task
-template <typename T>
+template <typename T, typename Compare>
 template <typename... Args>
-vector<std::pair<typename set<T>::iterator, bool>> set<T>::insert_many(
-    const Args &&...args) {
-  vector<std::pair<typename set<T>::iterator, bool>> res;
+vector<std::pair<typename set<T, Compare>::iterator, bool>>
+set<T, Compare>::insert_many(const Args &&...args) {
+  vector<std::pair<typename set<T, Compare>::iterator, bool>> res;
   for (const auto &e : {args...}) {
     res.push_back(insert(e));
   }
@@ -0,0 +1,89 @@
+#ifndef S21_CONTAINERS_SKIPLIST_MAP_SKIPLIST_MAP_H_  // NOLINT
+#define S21_CONTAINERS_SKIPLIST_MAP_SKIPLIST_MAP_H_  // NOLINT
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "skiplist_set/s21_skiplist_set.h"
+
+namespace s21 {
+
+// The key of a skiplist_map element is the first of the pair
+template <typename K, typename T>
+struct SkipListPairKey {
+  static const K &Get(const std::pair<const K, T> &value) {
+    return value.first;
+  }
+};
+
+// The s21::map interface over a skip list (see SkipList)
+template <typename K, typename T, typename Compare = std::less<K>>
+class skiplist_map
+    : public SkipList<K, std::pair<const K, T>, SkipListPairKey<K, T>,
+                      Compare> {
+  using Base =
+      SkipList<K, std::pair<const K, T>, SkipListPairKey<K, T>, Compare>;
+
+ public:
+  // Member type
+  using mapped_type = T;
+  using value_type = std::pair<const K, T>;
+  using iterator = typename Base::iterator;
+
+  // Functions
+  using Base::Base;
+  skiplist_map() = default;
+  skiplist_map(std::initializer_list<value_type> const &items) : Base() {
+    for (const value_type &item : items) this->insert(item);
+  }
+
+  // Element access
+  T &at(const K &key) {
+    iterator it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("skiplist_map::at");
+    }
+    return it->second;
+  }
+  const T &at(const K &key) const {
+    auto it = this->find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("skiplist_map::at");
+    }
+    return it->second;
+  }
+  T &operator[](const K &key) { return try_emplace(key).first->second; }
+
+  // Modifiers
+  using Base::insert;
+  std::pair<iterator, bool> insert(const K &key, const T &obj) {
+    return try_emplace(key, obj);
+  }
+  std::pair<iterator, bool> insert_or_assign(const K &key, const T &obj) {
+    std::pair<iterator, bool> res = try_emplace(key, obj);
+    if (!res.second) res.first->second = obj;
+    return res;
+  }
+  // Inserts {key, T(args...)} if the key is absent; makes no T otherwise
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const K &key, Args &&...args) {
+    return this->EmplaceKey(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  // Bonus task
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+    (res.push_back(this->insert(std::forward<Args>(args))), ...);
+    return res;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SKIPLIST_MAP_SKIPLIST_MAP_H_  // NOLINT
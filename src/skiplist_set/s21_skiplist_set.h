@@ -0,0 +1,576 @@
+#ifndef S21_CONTAINERS_SKIPLIST_SET_SKIPLIST_SET_H_  // NOLINT
+#define S21_CONTAINERS_SKIPLIST_SET_SKIPLIST_SET_H_  // NOLINT
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "vector/s21_vector.h"  // for bonus task
+
+namespace s21 {
+
+// The key of a skiplist_set is the value itself
+template <typename T>
+struct SkipListSelfKey {
+  static const T &Get(const T &value) { return value; }
+};
+
+// An ordered container of values with unique keys in a skip list: the
+// sorted linked list of the values plus express lanes above it. Every
+// node is on level 0 and on each next level with the given probability
+// (1/4 by default), so a search skips along the top levels and drops
+// down, taking O(log n) expected steps with no rebalancing. Level 0 is
+// a plain linked list, so iteration and range scans from lower_bound()
+// cost O(1) per element.
+//
+// A node and its tower of next pointers are one allocation. Inserting
+// keys in ascending order (a copy, a bulk load, time series) starts the
+// search from the towers of the previous insertion (a search finger)
+// instead of the head, which makes it O(1) expected.
+//
+// The next pointers are atomic and a new node is published by a release
+// store, so find(), contains(), count(), lower_bound(), upper_bound()
+// and forward iteration may run in any number of threads concurrently
+// with one thread that inserts (but doesn't erase: erased nodes are
+// freed right away).
+template <typename Key, typename T, typename KeyOf, typename Compare>
+class SkipList {
+  struct Node;
+  using Link = std::atomic<Node *>;
+
+ public:
+  // Member type
+  using key_type = Key;
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+  // The highest tower; 4^32 elements would be needed to fill it up at
+  // the default probability
+  static constexpr int kMaxHeight = 32;
+
+  template <bool Const>
+  class SkipListIterator {
+    // the values of a set are keys, which can't be changed in place
+    static constexpr bool kConst = Const || std::is_same<Key, T>::value;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<kConst, const T *, T *>;
+    using reference = std::conditional_t<kConst, const T &, T &>;
+
+    SkipListIterator() = default;
+    // iterator converts to const_iterator
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    SkipListIterator(const SkipListIterator<false> &other)  // NOLINT
+        : owner_(other.owner_), p_(other.p_) {}
+
+    reference operator*() const { return p_->data_; }
+    pointer operator->() const { return &p_->data_; }
+
+    SkipListIterator &operator++() {
+      p_ = p_->Next()[0].load(std::memory_order_acquire);
+      return *this;
+    }
+    SkipListIterator operator++(int) {
+      SkipListIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    SkipListIterator &operator--() {
+      p_ = p_ ? p_->prev_ : owner_->tail_;
+      return *this;
+    }
+    SkipListIterator operator--(int) {
+      SkipListIterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const SkipListIterator &rhs) const { return p_ == rhs.p_; }
+    bool operator!=(const SkipListIterator &rhs) const { return p_ != rhs.p_; }
+
+   private:
+    SkipListIterator(const SkipList *owner, Node *p) : owner_(owner), p_(p) {}
+
+    const SkipList *owner_ = nullptr;
+    // nullptr is the end
+    Node *p_ = nullptr;
+    friend class SkipList;
+    template <bool>
+    friend class SkipListIterator;
+  };
+
+  using iterator = SkipListIterator<false>;
+  using const_iterator = SkipListIterator<true>;
+
+  // Functions
+  // Each node goes one level up with the probability, which must be in
+  // (0, 1); lower values save memory and higher ones make searches
+  // shorter
+  explicit SkipList(double probability = 0.25,
+                    const Compare &comp = Compare());
+  SkipList(const SkipList &other);
+  SkipList(SkipList &&other) noexcept;
+  ~SkipList() { clear(); }
+  SkipList &operator=(SkipList other) noexcept;
+
+  // Iterators
+  iterator begin() noexcept { return iterator(this, First()); }
+  const_iterator begin() const noexcept {
+    return const_iterator(this, First());
+  }
+  iterator end() noexcept { return iterator(this, nullptr); }
+  const_iterator end() const noexcept { return const_iterator(this, nullptr); }
+
+  // Capacity
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return (~(size_type(0))) / (sizeof(Node) + sizeof(Link));
+  }
+  double probability() const noexcept { return probability_; }
+
+  // Modifiers
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return EmplaceKey(KeyOf::Get(value), value);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return EmplaceKey(KeyOf::Get(value), std::move(value));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  // Returns the iterator to the element after the erased one
+  iterator erase(const_iterator pos) noexcept;
+  size_type erase(const key_type &key) noexcept;
+  void swap(SkipList &other) noexcept;
+  // Moves the nodes whose keys aren't in this container from other,
+  // without allocating
+  void merge(SkipList &other) noexcept;
+
+  // Lookup
+  size_type count(const key_type &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+  iterator find(const key_type &key) noexcept {
+    return iterator(this, Find(key));
+  }
+  const_iterator find(const key_type &key) const noexcept {
+    return const_iterator(this, Find(key));
+  }
+  bool contains(const key_type &key) const noexcept {
+    return Find(key) != nullptr;
+  }
+  iterator lower_bound(const key_type &key) noexcept {
+    return iterator(this, Bound<false>(key));
+  }
+  const_iterator lower_bound(const key_type &key) const noexcept {
+    return const_iterator(this, Bound<false>(key));
+  }
+  iterator upper_bound(const key_type &key) noexcept {
+    return iterator(this, Bound<true>(key));
+  }
+  const_iterator upper_bound(const key_type &key) const noexcept {
+    return const_iterator(this, Bound<true>(key));
+  }
+
+ protected:
+  // Inserts the value made from args unless key (which must be its key)
+  // is there already; nothing is made in that case
+  template <typename... Args>
+  std::pair<iterator, bool> EmplaceKey(const key_type &key, Args &&...args);
+
+ private:
+  // The tower of a node is an array of links right after it in the same
+  // allocation; the head is a tower with no node
+  struct Node {
+    template <typename... Args>
+    explicit Node(int height, Args &&...args)
+        : data_(std::forward<Args>(args)...), height_(height) {}
+
+    Link *Next() noexcept {
+      return reinterpret_cast<Link *>(reinterpret_cast<char *>(this) +
+                                      kTowerOffset);
+    }
+
+    T data_;
+    // the previous node on level 0, for backward iteration
+    Node *prev_ = nullptr;
+    int height_;
+  };
+  static constexpr size_t kTowerOffset =
+      (sizeof(Node) + alignof(Link) - 1) / alignof(Link) * alignof(Link);
+  static_assert(alignof(Node) <= alignof(std::max_align_t),
+                "over-aligned values aren't supported");
+
+  template <typename... Args>
+  Node *MakeNode(Args &&...args);
+  static void FreeNode(Node *node) noexcept;
+
+  bool Less(const key_type &a, const key_type &b) const {
+    return comp_(a, b);
+  }
+  const key_type &KeyAt(Node *node) const { return KeyOf::Get(node->data_); }
+  Link *Head() const noexcept { return const_cast<Link *>(head_); }
+  Node *First() const noexcept {
+    return head_[0].load(std::memory_order_acquire);
+  }
+
+  // The first node whose key is not less than key (or greater than key
+  // for kUpper). If prev isn't null, puts the tower after which the key
+  // goes on each level below the top to prev.
+  template <bool kUpper>
+  Node *Bound(const key_type &key, Link **prev = nullptr) const noexcept;
+  Node *Find(const key_type &key) const noexcept;
+  // Like Bound<false>, but starts from the finger if key is greater
+  // than the key inserted last
+  Node *Locate(const key_type &key, Link **prev);
+  // Links node after the towers in prev and moves the finger to it
+  void Insert(Node *node, Link **prev) noexcept;
+  int RandomHeight() noexcept;
+  // Forgets all the nodes without freeing them
+  void Reset() noexcept;
+
+  Link head_[kMaxHeight] = {};
+  // the number of levels in use
+  std::atomic<int> level_{0};
+  Node *tail_ = nullptr;
+  size_type size_ = 0;
+
+  // The towers after which the last inserted node went on each level
+  // (its own one below its height); finger_node_ is nullptr when there
+  // is no valid finger
+  Link *finger_[kMaxHeight];
+  Node *finger_node_ = nullptr;
+
+  double probability_;
+  // a node goes a level up if a random uint32 is below the threshold
+  uint32_t threshold_;
+  uint32_t random_state_ = 2463534242u;
+  Compare comp_;
+};
+
+// Functions
+template <typename Key, typename T, typename KeyOf, typename Compare>
+SkipList<Key, T, KeyOf, Compare>::SkipList(double probability,
+                                           const Compare &comp)
+    : probability_(probability), comp_(comp) {
+  if (!(probability > 0 && probability < 1)) {
+    throw std::invalid_argument("The probability must be in (0, 1)");
+  }
+  threshold_ = static_cast<uint32_t>(probability * 4294967296.0);
+}
+
+// Appends the values in order, so every insertion takes O(1) with the
+// finger
+template <typename Key, typename T, typename KeyOf, typename Compare>
+SkipList<Key, T, KeyOf, Compare>::SkipList(const SkipList &other)
+    : SkipList(other.probability(), other.comp_) {
+  for (Node *p = other.First(); p; p = p->Next()[0].load()) insert(p->data_);
+}
+
+template <typename Key, typename T, typename KeyOf, typename Compare>
+SkipList<Key, T, KeyOf, Compare>::SkipList(SkipList &&other) noexcept
+    : probability_(other.probability_),
+      threshold_(other.threshold_),
+      comp_(other.comp_) {
+  swap(other);
+}
+
+template <typename Key, typename T, typename KeyOf, typename Compare>
+SkipList<Key, T, KeyOf, Compare> &SkipList<Key, T, KeyOf, Compare>::operator=(
+    SkipList other) noexcept {
+  swap(other);
+  return *this;
+}
+
+// Modifiers
+template <typename Key, typename T, typename KeyOf, typename Compare>
+void SkipList<Key, T, KeyOf, Compare>::clear() noexcept {
+  Node *p = First();
+  while (p) {
+    Node *next = p->Next()[0].load(std::memory_order_relaxed);
+    FreeNode(p);
+    p = next;
+  }
+  Reset();
+}
+
+template <typename Key, typename T, typename KeyOf, typename Compare>
+template <typename... Args>
+std::pair<typename SkipList<Key, T, KeyOf, Compare>::iterator, bool>
+SkipList<Key, T, KeyOf, Compare>::EmplaceKey(const key_type &key,
+                                             Args &&...args) {
+  Link *prev[kMaxHeight];
+  Node *found = Locate(key, prev);
+  if (found) return {iterator(this, found), false};
+  Node *node = MakeNode(std::forward<Args>(args)...);
+  Insert(node, prev);
+  return {iterator(this, node), true};
+}
+
+// The key is only known when the value is made
+template <typename Key, typename T, typename KeyOf, typename Compare>
+template <typename... Args>
+std::pair<typename SkipList<Key, T, KeyOf, Compare>::iterator, bool>
+SkipList<Key, T, KeyOf, Compare>::emplace(Args &&...args) {
+  Node *node = MakeNode(std::forward<Args>(args)...);
+  Link *prev[kMaxHeight];
+  Node *found = Locate(KeyAt(node), prev);
+  if (found) {
+    FreeNode(node);
+    return {iterator(this, found), false};
+  }
+  Insert(node, prev);
+  return {iterator(this, node), true};
+}
+
+template <typename Key, typename T, typename KeyOf, typename Compare>
+typename SkipList<Key, T, KeyOf, Compare>::iterator
+SkipList<Key, T, KeyOf, Compare>::erase(const_iterator pos) noexcept {
+  Node *node = pos.p_;
+  Link *prev[kMaxHeight];
+  // the search ends right before the node on every level it is on
+  Bound<false>(KeyAt(node), prev);
+  Node *next = node->Next()[0].load(std::memory_order_relaxed);
+  for (int i = 0; i < node->height_; ++i) {
+    prev[i][i].store(node->Next()[i].load(std::memory_order_relaxed),
+                     std::memory_order_release);
+  }
+  if (next)
+    next->prev_ = node->prev_;
+  else
+    tail_ = node->prev_;
+  int level = level_.load(std::memory_order_relaxed);
+  while (level > 0 && !head_[level - 1].load(std::memory_order_relaxed))
+    --level;
+  level_.store(level, std::memory_order_release);
+  finger_node_ = nullptr;
+  --size_;
+  FreeNode(node);
+  return iterator(this, next);
+}
+
+template <typename Key, typename T, typename KeyOf, typename Compare>
+typename SkipList<Key, T, KeyOf, Compare>::size_type
+SkipList<Key, T, KeyOf, Compare>::erase(const key_type &key) noexcept {
+  Node *node = Find(key);
+  if (!node) return 0;
+  erase(const_iterator(this, node));
+  return 1;
+}
+
+// The finger points into the towers of its own list, so it is dropped
+template <typename Key, typename T, typename KeyOf, typename Compare>
+void SkipList<Key, T, KeyOf, Compare>::swap(SkipList &other) noexcept {
+  for (int i = 0; i < kMaxHeight; ++i) {
+    Node *p = head_[i].load(std::memory_order_relaxed);
+    head_[i].store(other.head_[i].load(std::memory_order_relaxed),
+                   std::memory_order_relaxed);
+    other.head_[i].store(p, std::memory_order_relaxed);
+  }
+  int level = level_.load(std::memory_order_relaxed);
+  level_.store(other.level_.load(std::memory_order_relaxed));
+  other.level_.store(level);
+  std::swap(tail_, other.tail_);
+  std::swap(size_, other.size_);
+  std::swap(probability_, other.probability_);
+  std::swap(threshold_, other.threshold_);
+  std::swap(random_state_, other.random_state_);
+  std::swap(comp_, other.comp_);
+  finger_node_ = other.finger_node_ = nullptr;
+}
+
+// The nodes of other come out in order, so the ones that stay there go
+// back with the finger in O(1) each
+template <typename Key, typename T, typename KeyOf, typename Compare>
+void SkipList<Key, T, KeyOf, Compare>::merge(SkipList &other) noexcept {
+  if (this == &other) return;
+  Node *node = other.First();
+  other.Reset();
+  Link *prev[kMaxHeight];
+  while (node) {
+    Node *next = node->Next()[0].load(std::memory_order_relaxed);
+    if (Locate(KeyAt(node), prev)) {
+      other.Locate(other.KeyAt(node), prev);
+      other.Insert(node, prev);
+    } else {
+      Insert(node, prev);
+    }
+    node = next;
+  }
+}
+
+// Support functions
+template <typename Key, typename T, typename KeyOf, typename Compare>
+template <typename... Args>
+typename SkipList<Key, T, KeyOf, Compare>::Node *
+SkipList<Key, T, KeyOf, Compare>::MakeNode(Args &&...args) {
+  int height = RandomHeight();
+  void *raw = ::operator new(kTowerOffset + height * sizeof(Link));
+  Node *node;
+  try {
+    node = ::new (raw) Node(height, std::forward<Args>(args)...);
+  } catch (...) {
+    ::operator delete(raw);
+    throw;
+  }
+  for (int i = 0; i < height; ++i) ::new (&node->Next()[i]) Link(nullptr);
+  return node;
+}
+
+template <typename Key, typename T, typename KeyOf, typename Compare>
+void SkipList<Key, T, KeyOf, Compare>::FreeNode(Node *node) noexcept {
+  node->~Node();
+  ::operator delete(static_cast<void *>(node));
+}
+
+template <typename Key, typename T, typename KeyOf, typename Compare>
+template <bool kUpper>
+typename SkipList<Key, T, KeyOf, Compare>::Node *
+SkipList<Key, T, KeyOf, Compare>::Bound(const key_type &key,
+                                        Link **prev) const noexcept {
+  Link *x = Head();
+  Node *next = nullptr;
+  for (int i = level_.load(std::memory_order_acquire) - 1; i >= 0; --i) {
+    while ((next = x[i].load(std::memory_order_acquire)) &&
+           (kUpper ? !Less(key, KeyAt(next)) : Less(KeyAt(next), key)))
+      x = next->Next();
+    if (prev) prev[i] = x;
+  }
+  return next;
+}
+
+template <typename Key, typename T, typename KeyOf, typename Compare>
+typename SkipList<Key, T, KeyOf, Compare>::Node *
+SkipList<Key, T, KeyOf, Compare>::Find(const key_type &key) const noexcept {
+  Node *p = Bound<false>(key);
+  return p && !Less(key, KeyAt(p)) ? p : nullptr;
+}
+
+// Every tower of the finger is before the key. Climbs from level 0 while
+// the next node after the finger is still before the key: the first
+// level where it isn't is as high as the distance to the key needs,
+// and the finger is exactly before the key on it and all the levels
+// above (the next nodes there come after the finger node, so not before
+// the next node on this level). From there the search goes down as
+// usual.
+template <typename Key, typename T, typename KeyOf, typename Compare>
+typename SkipList<Key, T, KeyOf, Compare>::Node *
+SkipList<Key, T, KeyOf, Compare>::Locate(const key_type &key, Link **prev) {
+  int level = level_.load(std::memory_order_relaxed);
+  if (!finger_node_ || !Less(KeyAt(finger_node_), key)) {
+    Node *p = Bound<false>(key, prev);
+    return p && !Less(key, KeyAt(p)) ? p : nullptr;
+  }
+  int top = 0;
+  for (Node *next; top + 1 < level; ++top) {
+    next = finger_[top][top].load(std::memory_order_relaxed);
+    if (!next || !Less(KeyAt(next), key)) break;
+  }
+  for (int i = level - 1; i > top; --i) prev[i] = finger_[i];
+  Link *x = finger_[top];
+  Node *next = nullptr;
+  for (int i = top; i >= 0; --i) {
+    while ((next = x[i].load(std::memory_order_relaxed)) &&
+           Less(KeyAt(next), key))
+      x = next->Next();
+    prev[i] = x;
+  }
+  return next && !Less(key, KeyAt(next)) ? next : nullptr;
+}
+
+// The node gets its own links first and is published bottom-up, so a
+// concurrent reader either doesn't see it or sees it complete
+template <typename Key, typename T, typename KeyOf, typename Compare>
+void SkipList<Key, T, KeyOf, Compare>::Insert(Node *node,
+                                              Link **prev) noexcept {
+  int height = node->height_;
+  int level = level_.load(std::memory_order_relaxed);
+  for (int i = level; i < height; ++i) prev[i] = head_;
+  Link *tower = node->Next();
+  for (int i = 0; i < height; ++i) {
+    tower[i].store(prev[i][i].load(std::memory_order_relaxed),
+                   std::memory_order_relaxed);
+  }
+  node->prev_ = prev[0] == head_
+                    ? nullptr
+                    : reinterpret_cast<Node *>(
+                          reinterpret_cast<char *>(prev[0]) - kTowerOffset);
+  Node *next = tower[0].load(std::memory_order_relaxed);
+  if (next)
+    next->prev_ = node;
+  else
+    tail_ = node;
+  for (int i = 0; i < height; ++i)
+    prev[i][i].store(node, std::memory_order_release);
+  if (height > level) {
+    level = height;
+    level_.store(level, std::memory_order_release);
+  }
+  ++size_;
+
+  for (int i = 0; i < level; ++i) finger_[i] = i < height ? tower : prev[i];
+  finger_node_ = node;
+}
+
+// xorshift32; the height is geometric: each level is reached with the
+// probability of the threshold
+template <typename Key, typename T, typename KeyOf, typename Compare>
+int SkipList<Key, T, KeyOf, Compare>::RandomHeight() noexcept {
+  int height = 1;
+  for (;;) {
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+    if (height == kMaxHeight || random_state_ >= threshold_) return height;
+    ++height;
+  }
+}
+
+template <typename Key, typename T, typename KeyOf, typename Compare>
+void SkipList<Key, T, KeyOf, Compare>::Reset() noexcept {
+  for (Link &link : head_) link.store(nullptr, std::memory_order_relaxed);
+  level_.store(0, std::memory_order_release);
+  tail_ = nullptr;
+  size_ = 0;
+  finger_node_ = nullptr;
+}
+
+// The s21::set interface over a skip list
+template <typename Key, typename Compare = std::less<Key>>
+class skiplist_set : public SkipList<Key, Key, SkipListSelfKey<Key>, Compare> {
+  using Base = SkipList<Key, Key, SkipListSelfKey<Key>, Compare>;
+
+ public:
+  using iterator = typename Base::iterator;
+
+  using Base::Base;
+  skiplist_set() = default;
+  skiplist_set(std::initializer_list<Key> const &items) : Base() {
+    for (const Key &item : items) this->insert(item);
+  }
+
+  // Bonus task
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+    (res.push_back(this->insert(std::forward<Args>(args))), ...);
+    return res;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SKIPLIST_SET_SKIPLIST_SET_H_  // NOLINT
@@ -0,0 +1,342 @@
+#ifndef S21_CONTAINERS_SMALL_VECTOR_SMALL_VECTOR_H_  // NOLINT
+#define S21_CONTAINERS_SMALL_VECTOR_SMALL_VECTOR_H_  // NOLINT
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// A vector with the interface of s21::vector that keeps up to N
+// elements inside the object itself and allocates heap storage only
+// when it grows beyond N. Short vectors never touch the allocator.
+// Unlike s21::vector, it constructs only the elements it holds, so T
+// doesn't have to be default constructible.
+template <typename T, size_t N>
+class small_vector {
+ public:
+  // types
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  // constructors
+  small_vector() noexcept : arr_(Inline()), size_(0), capacity_(N) {}
+  explicit small_vector(size_type n);
+  small_vector(std::initializer_list<value_type> const &items);
+  small_vector(const small_vector &v);
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+  ~small_vector();
+
+  // overload
+  small_vector &operator=(const small_vector &v);
+  small_vector &operator=(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+
+  // element access
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) { return arr_[pos]; }
+  const_reference operator[](size_type pos) const { return arr_[pos]; }
+  reference front() { return arr_[0]; }
+  const_reference front() const { return arr_[0]; }
+  reference back() { return arr_[size_ - 1]; }
+  const_reference back() const { return arr_[size_ - 1]; }
+  T *data() noexcept { return arr_; }
+  const T *data() const noexcept { return arr_; }
+
+  // iterators
+  iterator begin() noexcept { return arr_; }
+  const_iterator begin() const noexcept { return arr_; }
+  iterator end() noexcept { return arr_ + size_; }
+  const_iterator end() const noexcept { return arr_ + size_; }
+
+  // capacity
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
+  }
+  void reserve(size_type size);
+  size_type capacity() const noexcept { return capacity_; }
+  void shrink_to_fit();
+
+  // true while the elements are stored inside the object
+  bool is_inline() const noexcept { return arr_ == Inline(); }
+
+  // modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const_reference value);
+  void erase(const_iterator pos);
+  void push_back(const_reference value);
+  void pop_back();
+  void swap(small_vector &other);
+
+  // bonus
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  T *Inline() noexcept { return reinterpret_cast<T *>(buffer_); }
+  const T *Inline() const noexcept {
+    return reinterpret_cast<const T *>(buffer_);
+  }
+
+  // Makes room for at least min_capacity elements, growing the same way
+  // s21::vector::push_back does.
+  void Grow(size_type min_capacity);
+
+  // Moves the elements to new_arr and frees the old heap storage.
+  void MoveTo(T *new_arr, size_type new_capacity);
+
+  // Moves the elements of v into this empty vector: steals the heap
+  // storage or moves the inline elements one by one.
+  void TakeFrom(small_vector &v);
+
+  // Constructs an element at the end; capacity must allow it.
+  template <typename... Args>
+  void ConstructBack(Args &&...args);
+
+  // The inline storage; its slots are constructed only up to size_.
+  alignas(T) unsigned char buffer_[sizeof(T) * (N ? N : 1)];
+  T *arr_;
+  size_type size_;
+  size_type capacity_;
+};
+
+// definitions
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(size_type n) : small_vector() {
+  reserve(n);
+  while (size_ < n) ConstructBack();
+}
+
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(
+    std::initializer_list<value_type> const &items)
+    : small_vector() {
+  reserve(items.size());
+  for (const value_type &item : items) ConstructBack(item);
+}
+
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(const small_vector &v) : small_vector() {
+  reserve(v.size_);
+  for (const value_type &item : v) ConstructBack(item);
+}
+
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible<T>::value)
+    : small_vector() {
+  TakeFrom(v);
+}
+
+template <typename T, size_t N>
+small_vector<T, N>::~small_vector() {
+  clear();
+  if (!is_inline()) std::allocator<T>().deallocate(arr_, capacity_);
+}
+
+template <typename T, size_t N>
+small_vector<T, N> &small_vector<T, N>::operator=(const small_vector &v) {
+  if (this != &v) {
+    small_vector tmp(v);
+    *this = std::move(tmp);
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+small_vector<T, N> &small_vector<T, N>::operator=(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+  if (this != &v) {
+    clear();
+    if (!is_inline()) {
+      std::allocator<T>().deallocate(arr_, capacity_);
+      arr_ = Inline();
+      capacity_ = N;
+    }
+    TakeFrom(v);
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+T &small_vector<T, N>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("out of range");
+  }
+  return arr_[pos];
+}
+
+template <typename T, size_t N>
+const T &small_vector<T, N>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("out of range");
+  }
+  return arr_[pos];
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::reserve(size_type size) {
+  if (size > capacity_) {
+    if (size > max_size()) throw std::length_error("small_vector too long");
+    MoveTo(std::allocator<T>().allocate(size), size);
+  }
+}
+
+// Returns to the inline storage if the elements fit there.
+template <typename T, size_t N>
+void small_vector<T, N>::shrink_to_fit() {
+  if (is_inline() || size_ == capacity_) return;
+  if (size_ <= N)
+    MoveTo(Inline(), N);
+  else
+    MoveTo(std::allocator<T>().allocate(size_), size_);
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::clear() noexcept {
+  std::destroy(begin(), end());
+  size_ = 0;
+}
+
+// The value is copied before the shift, so it may refer to an element
+// of the vector itself.
+template <typename T, size_t N>
+T *small_vector<T, N>::insert(const_iterator pos, const_reference value) {
+  size_type i = pos - begin();
+  value_type tmp(value);
+  if (size_ == capacity_) Grow(size_ + 1);
+  if (i == size_) {
+    ConstructBack(std::move(tmp));
+  } else {
+    ConstructBack(std::move(back()));
+    std::move_backward(arr_ + i, end() - 2, end() - 1);
+    arr_[i] = std::move(tmp);
+  }
+  return arr_ + i;
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::erase(const_iterator pos) {
+  iterator it = begin() + (pos - begin());
+  std::move(it + 1, end(), it);
+  pop_back();
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::push_back(const_reference value) {
+  if (size_ == capacity_) {
+    value_type tmp(value);
+    Grow(size_ + 1);
+    ConstructBack(std::move(tmp));
+  } else {
+    ConstructBack(value);
+  }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::pop_back() {
+  std::destroy_at(arr_ + --size_);
+}
+
+// Heap buffers are swapped in O(1); inline elements have to be moved.
+template <typename T, size_t N>
+void small_vector<T, N>::swap(small_vector &other) {
+  if (this == &other) return;
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(arr_, other.arr_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  } else {
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+}
+
+// Constructs the new elements at the end and rotates them into place,
+// so the tail is shifted once whatever the number of the elements.
+// args must not refer to the elements of the vector: it may reallocate
+// before they are used.
+template <typename T, size_t N>
+template <typename... Args>
+T *small_vector<T, N>::insert_many(const_iterator pos, Args &&...args) {
+  size_type i = pos - begin();
+  size_type old_size = size_;
+  Grow(size_ + sizeof...(args));
+  (ConstructBack(std::forward<Args>(args)), ...);
+  std::rotate(arr_ + i, arr_ + old_size, end());
+  return arr_ + i;
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+void small_vector<T, N>::insert_many_back(Args &&...args) {
+  Grow(size_ + sizeof...(args));
+  (ConstructBack(std::forward<Args>(args)), ...);
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::Grow(size_type min_capacity) {
+  if (min_capacity > capacity_)
+    reserve(std::max(min_capacity, capacity_ * 2 + 1));
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::MoveTo(T *new_arr, size_type new_capacity) {
+  T *old_arr = arr_;
+  bool was_inline = is_inline();
+  try {
+    std::uninitialized_move(begin(), end(), new_arr);
+  } catch (...) {
+    if (new_arr != Inline())
+      std::allocator<T>().deallocate(new_arr, new_capacity);
+    throw;
+  }
+  std::destroy(begin(), end());
+  if (!was_inline) std::allocator<T>().deallocate(old_arr, capacity_);
+  arr_ = new_arr;
+  capacity_ = new_capacity;
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::TakeFrom(small_vector &v) {
+  if (v.is_inline()) {
+    for (value_type &item : v) ConstructBack(std::move(item));
+    v.clear();
+  } else {
+    arr_ = v.arr_;
+    size_ = v.size_;
+    capacity_ = v.capacity_;
+    v.arr_ = v.Inline();
+    v.size_ = 0;
+    v.capacity_ = N;
+  }
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+void small_vector<T, N>::ConstructBack(Args &&...args) {
+  ::new (static_cast<void *>(arr_ + size_)) T(std::forward<Args>(args)...);
+  ++size_;
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SMALL_VECTOR_SMALL_VECTOR_H_  // NOLINT
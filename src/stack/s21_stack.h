@@ -1,112 +1,79 @@
 #ifndef S21_CONTAINERS_STACK_STACK_H_  // NOLINT
 #define S21_CONTAINERS_STACK_STACK_H_  // NOLINT
 
-#include <exception>
 #include <initializer_list>
-#include <iostream>
+#include <utility>
 
 #include "vector/s21_vector.h"
 
 namespace s21 {
 
-template <typename T>
+// A LIFO adaptor over Container, which needs back(), push_back(),
+// pop_back(), insert_many_back(), size(), empty() and swap(): s21::vector
+// (the default), small_vector, static_vector or list. Copies and moves
+// are the ones of the container, so moving a stack over a vector is
+// O(1) and noexcept.
+template <typename T, typename Container = vector<T>>
 class stack {
  public:
   // overrides
+  using container_type = Container;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
 
   // constructors
-  stack() noexcept {
-    size_ = 0;
-    arr_ = vector<T>();
-  }
-
+  stack() = default;
   stack(std::initializer_list<value_type> const &items);
-  stack(const stack &s);
-  stack(stack &&s) noexcept;
+  explicit stack(const container_type &container) : container_(container) {}
+  explicit stack(container_type &&container)
+      : container_(std::move(container)) {}
 
-  ~stack() { size_ = 0; }
+  // element access
+  const_reference top() const { return container_.back(); }
+  bool empty() const noexcept { return container_.empty(); }
+  size_type size() const noexcept { return container_.size(); }
 
-  stack &operator=(const stack &s) noexcept {
-    if (this != &s) {
-      stack tmp(s);
-      swap(tmp);
-    }
-    return *this;
-  }
+  void push(const_reference value) { container_.push_back(value); }
+  void pop() { container_.pop_back(); }
 
-  stack &operator=(stack &&s) noexcept {
-    if (this != &s) {
-      stack tmp(std::move(s));
-      swap(tmp);
-    }
-    return *this;
+  // Pushes an element constructed from args. The containers have no
+  // emplace_back, so it is made as a temporary and moved in.
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    container_.insert_many_back(value_type(std::forward<Args>(args)...));
   }
 
-  // element access
-  const_reference top() const { return arr_.back(); }
-  bool empty() const noexcept { return size_ ? 0 : 1; }
-  size_type size() { return size_; }
-
-  void push(const_reference value) {
-    arr_.push_back(value);
-    size_++;
-  }
-  void pop() {
-    arr_.pop_back();
-    size_--;
+  // Makes room for size elements, if the container can
+  template <typename C = Container>
+  auto reserve(size_type size)
+      -> decltype(std::declval<C &>().reserve(size)) {
+    return container_.reserve(size);
   }
 
-  void swap(stack &other);
+  void swap(stack &other) noexcept(noexcept(
+      std::declval<Container &>().swap(std::declval<Container &>()))) {
+    container_.swap(other.container_);
+  }
   template <typename... Args>
   void insert_many_front(Args &&...args);
 
  private:
-  size_t size_;
-  vector<T> arr_;
+  container_type container_;
 };
 
 // functions
-template <typename T>
-stack<T>::stack(std::initializer_list<value_type> const &items) {
-  arr_ = vector<T>(items);
-  size_ = items.size();
-}
+template <typename T, typename Container>
+stack<T, Container>::stack(std::initializer_list<value_type> const &items)
+    : container_(items) {}
 
-template <typename T>
-stack<T>::stack(const stack &s) {
-  size_ = s.size_;
-  arr_.reserve(size_);
-  for (int i = 0; i < (int)size_; i++) {
-    arr_.push_back(s.arr_[i]);
-  }
-}
-
-template <typename T>
-stack<T>::stack(stack &&s) noexcept {
-  size_ = s.size_;
-  arr_ = vector(s.arr_);
-  s.size_ = 0;
-}
-
-template <typename T>
-void stack<T>::swap(stack &other) {
-  arr_.swap(other.arr_);
-  size_t temp_size = other.size_;
-  other.size_ = size_;
-  size_ = temp_size;
-}
-
-template <typename T>
+// pushes args in order, so the last one ends up on top. The values are
+// made before the container grows, so args may refer to the elements.
+template <typename T, typename Container>
 template <typename... Args>
-void stack<T>::insert_many_front(Args &&...args) {
-  vector<T> a = {args...};
-  for (int i = 0; i < (int)sizeof...(args); i++) {
-    push(a[i]);
-  }
+void stack<T, Container>::insert_many_front(Args &&...args) {
+  container_.insert_many_back(value_type(std::forward<Args>(args))...);
 }
 
 }  // namespace s21
@@ -0,0 +1,323 @@
+#ifndef S21_CONTAINERS_STATIC_VECTOR_STATIC_VECTOR_H_  // NOLINT
+#define S21_CONTAINERS_STATIC_VECTOR_STATIC_VECTOR_H_  // NOLINT
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Storage of static_vector. A trivial T lives in a plain array, which
+// keeps static_vector trivially copyable and usable in constant
+// expressions (C++17 requires the array to be initialized for that).
+template <typename T, size_t N, bool = std::is_trivial<T>::value>
+struct StaticVectorStorage {
+  constexpr T *Data() noexcept { return data_; }
+  constexpr const T *Data() const noexcept { return data_; }
+
+  T data_[N ? N : 1]{};
+  size_t size_ = 0;
+};
+
+// Any other T lives in raw memory: only the first size_ slots hold
+// constructed elements.
+template <typename T, size_t N>
+struct StaticVectorStorage<T, N, false> {
+  StaticVectorStorage() noexcept {}
+  StaticVectorStorage(const StaticVectorStorage &other) {
+    std::uninitialized_copy(other.Data(), other.Data() + other.size_, Data());
+    size_ = other.size_;
+  }
+  StaticVectorStorage(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value) {
+    std::uninitialized_move(other.Data(), other.Data() + other.size_, Data());
+    size_ = other.size_;
+  }
+  ~StaticVectorStorage() { std::destroy(Data(), Data() + size_); }
+
+  StaticVectorStorage &operator=(const StaticVectorStorage &other) {
+    if (this != &other) Assign(other.Data(), other.size_);
+    return *this;
+  }
+  StaticVectorStorage &operator=(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_assignable<T>::value &&
+      std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other)
+      Assign(std::make_move_iterator(other.Data()), other.size_);
+    return *this;
+  }
+
+  T *Data() noexcept { return std::launder(reinterpret_cast<T *>(buffer_)); }
+  const T *Data() const noexcept {
+    return std::launder(reinterpret_cast<const T *>(buffer_));
+  }
+
+  // Assigns over the common prefix, then constructs or destroys the
+  // rest.
+  template <typename It>
+  void Assign(It first, size_t n) {
+    size_t common = n < size_ ? n : size_;
+    for (size_t i = 0; i < common; ++i, ++first) Data()[i] = *first;
+    if (n > size_) {
+      std::uninitialized_copy_n(first, n - size_, Data() + size_);
+    } else {
+      std::destroy(Data() + n, Data() + size_);
+    }
+    size_ = n;
+  }
+
+  alignas(T) unsigned char buffer_[sizeof(T) * (N ? N : 1)];
+  size_t size_ = 0;
+};
+
+// A vector with the interface of s21::vector whose N slots live inside
+// the object: it never allocates. The functions that would exceed the
+// capacity throw std::length_error; try_push_back and try_emplace_back
+// return nullptr instead, for the code that can't use exceptions.
+template <typename T, size_t N>
+class static_vector {
+ public:
+  // types
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  // constructors
+  constexpr static_vector() noexcept = default;
+  constexpr explicit static_vector(size_type n);
+  constexpr static_vector(std::initializer_list<value_type> const &items);
+
+  // element access
+  constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos) { return data()[pos]; }
+  constexpr const_reference operator[](size_type pos) const {
+    return data()[pos];
+  }
+  constexpr reference front() { return data()[0]; }
+  constexpr const_reference front() const { return data()[0]; }
+  constexpr reference back() { return data()[size() - 1]; }
+  constexpr const_reference back() const { return data()[size() - 1]; }
+  constexpr T *data() noexcept { return storage_.Data(); }
+  constexpr const T *data() const noexcept { return storage_.Data(); }
+
+  // iterators
+  constexpr iterator begin() noexcept { return data(); }
+  constexpr const_iterator begin() const noexcept { return data(); }
+  constexpr iterator end() noexcept { return data() + size(); }
+  constexpr const_iterator end() const noexcept { return data() + size(); }
+
+  // capacity
+  constexpr bool empty() const noexcept { return storage_.size_ == 0; }
+  constexpr size_type size() const noexcept { return storage_.size_; }
+  constexpr size_type max_size() const noexcept { return N; }
+  constexpr void reserve(size_type size) const;
+  constexpr size_type capacity() const noexcept { return N; }
+  constexpr void shrink_to_fit() const noexcept {}
+
+  // modifiers
+  constexpr void clear() noexcept;
+  constexpr iterator insert(const_iterator pos, const_reference value);
+  constexpr void erase(const_iterator pos);
+  constexpr void push_back(const_reference value);
+  constexpr void pop_back();
+  constexpr void swap(static_vector &other);
+
+  // Non-throwing appends: return a pointer to the new element, or
+  // nullptr (leaving the vector untouched) if it is full.
+  constexpr T *try_push_back(const_reference value);
+  template <typename... Args>
+  constexpr T *try_emplace_back(Args &&...args);
+
+  // bonus
+  template <typename... Args>
+  constexpr iterator insert_many(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  constexpr void insert_many_back(Args &&...args);
+
+ private:
+  static constexpr bool kTrivial = std::is_trivial<T>::value;
+
+  // Throws if n more elements don't fit.
+  constexpr void CheckRoom(size_type n) const;
+
+  // Constructs an element at the end; there must be room for it.
+  template <typename... Args>
+  constexpr void ConstructBack(Args &&...args);
+
+  // Rotates [first, last) so that middle becomes the first element.
+  static constexpr void Rotate(T *first, T *middle, T *last);
+  static constexpr void Reverse(T *first, T *last);
+
+  StaticVectorStorage<T, N> storage_;
+};
+
+// definitions
+template <typename T, size_t N>
+constexpr static_vector<T, N>::static_vector(size_type n) {
+  CheckRoom(n);
+  while (size() < n) ConstructBack();
+}
+
+template <typename T, size_t N>
+constexpr static_vector<T, N>::static_vector(
+    std::initializer_list<value_type> const &items) {
+  CheckRoom(items.size());
+  for (const value_type &item : items) ConstructBack(item);
+}
+
+template <typename T, size_t N>
+constexpr T &static_vector<T, N>::at(size_type pos) {
+  if (pos >= size()) {
+    throw std::out_of_range("out of range");
+  }
+  return data()[pos];
+}
+
+template <typename T, size_t N>
+constexpr const T &static_vector<T, N>::at(size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("out of range");
+  }
+  return data()[pos];
+}
+
+template <typename T, size_t N>
+constexpr void static_vector<T, N>::reserve(size_type size) const {
+  if (size > N) throw std::length_error("static_vector capacity exceeded");
+}
+
+template <typename T, size_t N>
+constexpr void static_vector<T, N>::clear() noexcept {
+  if constexpr (!kTrivial) std::destroy(begin(), end());
+  storage_.size_ = 0;
+}
+
+template <typename T, size_t N>
+constexpr T *static_vector<T, N>::insert(const_iterator pos,
+                                         const_reference value) {
+  CheckRoom(1);
+  size_type i = pos - begin();
+  if (i == size()) {
+    ConstructBack(value);
+  } else {
+    value_type tmp(value);
+    ConstructBack(std::move(back()));
+    for (size_type k = size() - 2; k > i; --k)
+      data()[k] = std::move(data()[k - 1]);
+    data()[i] = std::move(tmp);
+  }
+  return data() + i;
+}
+
+template <typename T, size_t N>
+constexpr void static_vector<T, N>::erase(const_iterator pos) {
+  for (size_type k = pos - begin(); k + 1 < size(); ++k)
+    data()[k] = std::move(data()[k + 1]);
+  pop_back();
+}
+
+template <typename T, size_t N>
+constexpr void static_vector<T, N>::push_back(const_reference value) {
+  CheckRoom(1);
+  ConstructBack(value);
+}
+
+template <typename T, size_t N>
+constexpr void static_vector<T, N>::pop_back() {
+  --storage_.size_;
+  if constexpr (!kTrivial) std::destroy_at(data() + size());
+}
+
+// Swaps the common prefix and moves the rest of the longer vector.
+template <typename T, size_t N>
+constexpr void static_vector<T, N>::swap(static_vector &other) {
+  static_vector *longer = size() < other.size() ? &other : this;
+  static_vector *shorter = longer == this ? &other : this;
+  size_type common = shorter->size();
+  for (size_type i = 0; i < common; ++i) {
+    value_type tmp(std::move(data()[i]));
+    data()[i] = std::move(other.data()[i]);
+    other.data()[i] = std::move(tmp);
+  }
+  for (size_type i = common; i < longer->size(); ++i)
+    shorter->ConstructBack(std::move(longer->data()[i]));
+  while (longer->size() > common) longer->pop_back();
+}
+
+template <typename T, size_t N>
+constexpr T *static_vector<T, N>::try_push_back(const_reference value) {
+  return try_emplace_back(value);
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr T *static_vector<T, N>::try_emplace_back(Args &&...args) {
+  if (size() == N) return nullptr;
+  ConstructBack(std::forward<Args>(args)...);
+  return data() + size() - 1;
+}
+
+// Constructs the new elements at the end and rotates them into place.
+template <typename T, size_t N>
+template <typename... Args>
+constexpr T *static_vector<T, N>::insert_many(const_iterator pos,
+                                              Args &&...args) {
+  CheckRoom(sizeof...(args));
+  size_type i = pos - begin();
+  size_type old_size = size();
+  (ConstructBack(std::forward<Args>(args)), ...);
+  Rotate(data() + i, data() + old_size, end());
+  return data() + i;
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr void static_vector<T, N>::insert_many_back(Args &&...args) {
+  CheckRoom(sizeof...(args));
+  (ConstructBack(std::forward<Args>(args)), ...);
+}
+
+template <typename T, size_t N>
+constexpr void static_vector<T, N>::CheckRoom(size_type n) const {
+  if (n > N - size())
+    throw std::length_error("static_vector capacity exceeded");
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr void static_vector<T, N>::ConstructBack(Args &&...args) {
+  if constexpr (kTrivial)
+    data()[size()] = T(std::forward<Args>(args)...);
+  else
+    ::new (static_cast<void *>(data() + size())) T(std::forward<Args>(args)...);
+  ++storage_.size_;
+}
+
+template <typename T, size_t N>
+constexpr void static_vector<T, N>::Rotate(T *first, T *middle, T *last) {
+  Reverse(first, middle);
+  Reverse(middle, last);
+  Reverse(first, last);
+}
+
+template <typename T, size_t N>
+constexpr void static_vector<T, N>::Reverse(T *first, T *last) {
+  for (; first < last && first < --last; ++first) {
+    value_type tmp(std::move(*first));
+    *first = std::move(*last);
+    *last = std::move(tmp);
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_STATIC_VECTOR_STATIC_VECTOR_H_  // NOLINT
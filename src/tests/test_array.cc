@@ -6,6 +6,8 @@
 #include <cmath>
 #include <iostream>
 #include <iterator>
+#include <string>
+#include <type_traits>
 #include <utility>
 
 #include "s21_containersplus.h"
@@ -46,8 +48,11 @@ TEST(array_oper_SCOBKA, with_int) {
     EXPECT_EQ(a[i], s21_a[i]);
   }
 
-  EXPECT_ANY_THROW(s21_a[-1]);
-  EXPECT_ANY_THROW(s21_a[s21_a.size() + 1]);
+  // unchecked like std::array's
+  static_assert(noexcept(s21_a[s21_a.size()]));
+  const s21::array<int, 10> &c = s21_a;
+  EXPECT_EQ(&c[3], s21_a.data() + 3);
+  EXPECT_ANY_THROW(c.at(10));
 }
 
 TEST(array_front_back, with_int) {
@@ -156,3 +161,50 @@ TEST(array_fill, with_int) {
     EXPECT_EQ(a[i], s21_a[i]);
   }
 }
+
+namespace {
+
+constexpr s21::array<int, 16> Squares() {
+  s21::array<int, 16> table;
+  for (size_t i = 0; i < table.size(); i++) table[i] = int(i * i);
+  return table;
+}
+
+}  // namespace
+
+TEST(array_constexpr, lookup_table) {
+  constexpr s21::array<int, 16> kSquares = Squares();
+  static_assert(kSquares[15] == 225);
+  static_assert(kSquares.back() == 225 && kSquares.front() == 0);
+  static_assert(kSquares.size() == 16 && !kSquares.empty());
+  static_assert(*(kSquares.end() - 2) == 196);
+  static_assert(std::is_trivially_copyable<s21::array<int, 16>>::value);
+
+  constexpr s21::array<int, 3> kA = {1, 2, 3};
+  constexpr s21::array<int, 3> kB = {1, 2, 4};
+  static_assert(kA < kB && kA <= kB && kB > kA && kB >= kA);
+  static_assert(kA != kB && kA == s21::array<int, 3>({1, 2, 3}));
+  static_assert(s21::array<int, 3>().back() == 0);
+
+  int sum = 0;
+  for (int x : kSquares) sum += x;
+  EXPECT_EQ(sum, 1240);
+}
+
+TEST(array_compare, with_string) {
+  s21::array<std::string, 2> a = {"a", "b"};
+  s21::array<std::string, 2> b = a;
+  EXPECT_TRUE(a == b);
+  b.back() = "c";
+  EXPECT_TRUE(a < b);
+  EXPECT_FALSE(b <= a);
+  a.swap(b);
+  EXPECT_EQ(a[1], "c");
+  EXPECT_EQ(b[1], "b");
+  b.fill("z");
+  EXPECT_TRUE(a < b);
+
+  s21::array<int, 0> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+}
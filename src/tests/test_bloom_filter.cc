@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "s21_containersplus.h"
+
+using s21::bloom_filter;
+using s21::filtered_map;
+
+TEST(BloomFilter, no_false_negatives) {
+  for (double rate : {0.1, 0.01, 0.001}) {
+    bloom_filter<int> filter(20000, rate);
+    ASSERT_EQ(filter.capacity(), 20000);
+    ASSERT_EQ(filter.false_positive_rate(), rate);
+    for (int i = 0; i < 20000; ++i) filter.insert(i * 2);
+    ASSERT_EQ(filter.size(), 20000);
+    int false_positives = 0;
+    for (int i = 0; i < 20000; ++i) {
+      ASSERT_TRUE(filter.may_contain(i * 2));
+      false_positives += filter.may_contain(i * 2 + 1);
+    }
+    // the rate holds up to noise
+    ASSERT_LT(false_positives, 20000 * rate * 1.5 + 10);
+    if (rate == 0.001) {
+      ASSERT_GT(filter.bit_count(), 20000 * 10);
+    }
+  }
+}
+
+TEST(BloomFilter, strings_and_clear) {
+  bloom_filter<std::string> filter(100);
+  filter.insert("apple");
+  filter.insert("pear");
+  ASSERT_TRUE(filter.may_contain("apple"));
+  ASSERT_TRUE(filter.may_contain("pear"));
+  ASSERT_FALSE(filter.may_contain(""));
+  bloom_filter<std::string> other(10);
+  other.swap(filter);
+  ASSERT_TRUE(other.may_contain("pear"));
+  ASSERT_EQ(filter.size(), 0);
+  other.clear();
+  ASSERT_FALSE(other.may_contain("apple"));
+  ASSERT_EQ(other.capacity(), 100);
+
+  ASSERT_THROW(bloom_filter<int>(10, 0.0), std::invalid_argument);
+  ASSERT_THROW(bloom_filter<int>(10, 1.0), std::invalid_argument);
+}
+
+TEST(FilteredMap, matches_map) {
+  // the filter is rebuilt several times on the way
+  filtered_map<int, int> m;
+  std::map<int, int> expected;
+  std::mt19937 gen(17);
+  for (int i = 0; i < 40000; ++i) {
+    int key = gen() % 20000;
+    switch (gen() % 4) {
+      case 0:
+        ASSERT_EQ(m.erase(key), expected.erase(key));
+        break;
+      case 1:
+        ASSERT_EQ(m.count(key), expected.count(key));
+        break;
+      default:
+        ASSERT_EQ(m.insert(key, i).second, expected.insert({key, i}).second);
+    }
+    ASSERT_EQ(m.contains(key), expected.count(key) == 1);
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  auto expected_it = expected.begin();
+  for (const auto &item : m) ASSERT_EQ(item, *expected_it++);
+  ASSERT_GE(m.filter().capacity(), m.size());
+  ASSERT_LE(m.filter().size(), m.filter().capacity());
+}
+
+TEST(FilteredMap, map_api) {
+  filtered_map<std::string, int> m = {{"one", 1}, {"two", 2}};
+  ASSERT_EQ(m.at("one"), 1);
+  ASSERT_THROW(m.at("three"), std::out_of_range);
+  m["three"] = 3;
+  ASSERT_EQ(m.find("three")->second, 3);
+  ASSERT_EQ(m.find("four"), m.end());
+  m.insert_or_assign("one", 10);
+  ASSERT_EQ(m.at("one"), 10);
+  ASSERT_EQ(m.lower_bound("p")->first, "three");
+  m.erase(m.find("two"));
+  ASSERT_FALSE(m.contains("two"));
+
+  filtered_map<std::string, int> copy(m);
+  ASSERT_EQ(copy.at("three"), 3);
+  filtered_map<std::string, int> other(0.001);
+  other.swap(copy);
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(other.size(), 2);
+  ASSERT_EQ(other.filter().false_positive_rate(), 0.01);
+  other.clear();
+  ASSERT_TRUE(other.empty());
+  ASSERT_FALSE(other.contains("one"));
+  const auto &cm = m;
+  ASSERT_EQ(cm.at("three"), 3);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_containersplus.h"
+
+using s21::concurrent_stack;
+
+namespace {
+
+// Every thread pushes its own range of numbers and pops as many
+// elements; in the end each number has to be seen exactly once.
+void PushPopFromThreads(concurrent_stack<int> *s) {
+  const int kThreads = 4;
+  const int kPerThread = 20000;
+  std::vector<std::atomic<int>> seen(kThreads * kPerThread);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([s, &seen, t] {
+      int value = 0;
+      for (int i = 0; i < kPerThread; ++i) {
+        s->push(t * kPerThread + i);
+        if (i % 2 && s->try_pop(&value)) ++seen[value];
+      }
+      while (s->try_pop(&value)) ++seen[value];
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+
+  int value = 0;
+  while (s->try_pop(&value)) ++seen[value];
+  for (const std::atomic<int> &count : seen) ASSERT_EQ(count.load(), 1);
+}
+
+}  // namespace
+
+TEST(ConcurrentStack, lifo) {
+  concurrent_stack<std::string> s;
+  ASSERT_TRUE(s.empty());
+  std::string value;
+  ASSERT_FALSE(s.try_pop(&value));
+
+  s.push("a");
+  s.push(std::string(100, 'b'));
+  s.emplace(3, 'c');
+  ASSERT_FALSE(s.empty());
+  ASSERT_TRUE(s.try_pop(&value));
+  ASSERT_EQ(value, "ccc");
+  ASSERT_TRUE(s.try_pop(&value));
+  ASSERT_EQ(value, std::string(100, 'b'));
+
+  // the popped nodes are reused, the rest is freed by the destructor
+  s.push("d");
+  s.push("e");
+  ASSERT_TRUE(s.try_pop(&value));
+  ASSERT_EQ(value, "e");
+}
+
+TEST(ConcurrentStack, push_list_pop_all) {
+  concurrent_stack<std::unique_ptr<int>> s;
+  s.push(std::make_unique<int>(0));
+  std::vector<int *> items = {new int(1), new int(2), new int(3)};
+  s.push_list(items.begin(), items.end());
+
+  std::vector<std::unique_ptr<int>> all;
+  s.pop_all(std::back_inserter(all));
+  ASSERT_TRUE(s.empty());
+  ASSERT_EQ(all.size(), 4);
+  for (int i = 0; i < 4; ++i) ASSERT_EQ(*all[i], 3 - i);
+
+  s.push_list(items.end(), items.end());
+  ASSERT_TRUE(s.empty());
+}
+
+TEST(ConcurrentStack, threads) {
+  concurrent_stack<int> s;
+  PushPopFromThreads(&s);
+}
+
+TEST(ConcurrentStack, threads_with_elimination) {
+  concurrent_stack<int> s(8);
+  PushPopFromThreads(&s);
+}
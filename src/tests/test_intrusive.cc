@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "s21_containersplus.h"
+
+namespace {
+
+// An object that is in a queue, a set by name and a map by id at once
+struct Task {
+  Task(int id, std::string name) : id(id), name(std::move(name)) {}
+
+  bool operator<(const Task &other) const { return name < other.name; }
+
+  int id;
+  std::string name;
+  s21::intrusive_list_hook in_queue;
+  s21::intrusive_list_hook in_done;
+  s21::intrusive_set_hook<Task> by_name;
+  s21::intrusive_set_hook<Task> by_id;
+};
+
+using Queue = s21::intrusive_list<Task, &Task::in_queue>;
+using Done = s21::intrusive_list<Task, &Task::in_done>;
+using ByName = s21::intrusive_set<Task, &Task::by_name>;
+using ById = s21::intrusive_map<int, Task, &Task::id, &Task::by_id>;
+
+std::vector<int> Ids(const Queue &q) {
+  std::vector<int> ids;
+  for (const Task &task : q) ids.push_back(task.id);
+  return ids;
+}
+
+}  // namespace
+
+TEST(IntrusiveList, link_unlink) {
+  Task a(1, "a"), b(2, "b"), c(3, "c");
+  Queue q;
+  q.push_back(b);
+  q.push_front(a);
+  q.push_back(c);
+  ASSERT_EQ(q.size(), 3);
+  ASSERT_EQ(&q.front(), &a);
+  ASSERT_EQ(&q.back(), &c);
+  ASSERT_EQ(Ids(q), std::vector<int>({1, 2, 3}));
+  ASSERT_THROW(q.push_back(a), std::invalid_argument);
+
+  // O(1) removal given the object
+  q.erase(b);
+  ASSERT_FALSE(b.in_queue.is_linked());
+  ASSERT_EQ(Ids(q), std::vector<int>({1, 3}));
+  q.insert(q.iterator_to(c), b);
+  ASSERT_EQ(Ids(q), std::vector<int>({1, 2, 3}));
+  q.reverse();
+  ASSERT_EQ(Ids(q), std::vector<int>({3, 2, 1}));
+  ASSERT_EQ(q.erase(q.begin())->id, 2);
+  q.pop_back();
+  q.pop_front();
+  ASSERT_TRUE(q.empty());
+  ASSERT_THROW(q.pop_front(), std::logic_error);
+  ASSERT_FALSE(a.in_queue.is_linked());
+}
+
+TEST(IntrusiveList, several_lists) {
+  std::vector<Task> tasks;
+  for (int i = 0; i < 6; ++i) tasks.emplace_back(i, std::to_string(i));
+  Queue q;
+  Done done;
+  for (Task &task : tasks) q.push_back(task);
+  for (Task &task : tasks)
+    if (task.id % 2) done.push_front(task);
+  ASSERT_EQ(q.size(), 6);
+  ASSERT_EQ(done.front().id, 5);
+
+  Queue other;
+  other.splice(other.end(), q);
+  ASSERT_TRUE(q.empty());
+  Queue moved(std::move(other));
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(Ids(moved), std::vector<int>({0, 1, 2, 3, 4, 5}));
+  q.swap(moved);
+  ASSERT_EQ(q.size(), 6);
+
+  // a copy isn't linked; clear unlinks everything
+  Task copy = tasks[0];
+  ASSERT_FALSE(copy.in_queue.is_linked());
+  q.clear();
+  for (const Task &task : tasks) ASSERT_FALSE(task.in_queue.is_linked());
+  ASSERT_TRUE(tasks[1].in_done.is_linked());
+}
+
+TEST(IntrusiveSet, ordered) {
+  std::vector<Task> tasks;
+  std::mt19937 gen(3);
+  for (int i = 0; i < 500; ++i) tasks.emplace_back(i, std::to_string(gen()));
+  ByName set;
+  std::set<std::string> expected;
+  for (Task &task : tasks) {
+    auto [it, inserted] = set.insert(task);
+    ASSERT_EQ(inserted, expected.insert(task.name).second);
+    ASSERT_EQ(it->name, task.name);
+  }
+  ASSERT_EQ(set.size(), expected.size());
+  ASSERT_TRUE(std::equal(set.begin(), set.end(), expected.begin(),
+                         [](const Task &t, const std::string &name) {
+                           return t.name == name;
+                         }));
+
+  for (size_t i = 0; i < tasks.size(); i += 2) {
+    if (!tasks[i].by_name.is_linked()) continue;
+    set.erase(set.iterator_to(tasks[i]));
+    expected.erase(tasks[i].name);
+  }
+  ASSERT_EQ(set.size(), expected.size());
+  Task probe(0, *expected.begin());
+  ASSERT_TRUE(set.contains(probe));
+  ASSERT_EQ(set.find(probe)->name, probe.name);
+  ASSERT_EQ(set.lower_bound(probe)->name, probe.name);
+  ASSERT_EQ(set.erase(probe), 1);
+  ASSERT_EQ(set.erase(probe), 0);
+  set.clear();
+  for (const Task &task : tasks) ASSERT_FALSE(task.by_name.is_linked());
+}
+
+TEST(IntrusiveMap, by_member_key) {
+  Task a(7, "a"), b(3, "b"), c(5, "c"), dup(5, "dup");
+  ById map;
+  map.insert(a);
+  map.insert(b);
+  map.insert(c);
+  ASSERT_FALSE(map.insert(dup).second);
+  ASSERT_FALSE(dup.by_id.is_linked());
+  ASSERT_EQ(map.at(5).name, "c");
+  ASSERT_THROW(map.at(4), std::out_of_range);
+  std::vector<int> ids;
+  for (const Task &task : map) ids.push_back(task.id);
+  ASSERT_EQ(ids, std::vector<int>({3, 5, 7}));
+  ASSERT_EQ(map.upper_bound(5)->id, 7);
+  ASSERT_EQ(--map.end(), map.iterator_to(a));
+
+  // the same object is in a set and a list too
+  ByName set;
+  Queue q;
+  set.insert(c);
+  q.push_back(c);
+  map.erase(map.find(5));
+  ASSERT_FALSE(map.contains(5));
+  ASSERT_TRUE(set.contains(c));
+  ASSERT_EQ(&q.front(), &c);
+
+  ById other(std::move(map));
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(other.size(), 2);
+}
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <iterator>
@@ -774,3 +775,99 @@ TEST(list, ListOfStrings) {
 
   EXPECT_EQ(sum, "01234");
 }
+
+TEST(list_merge, with_compare) {
+  s21::list<int> s21_a = {9, 5, 5, 1};
+  s21::list<int> s21_b = {8, 5, 2};
+  s21_a.merge(s21_b, std::greater<int>());
+  EXPECT_TRUE(s21_b.empty());
+
+  std::list<int> std_a = {9, 5, 5, 1};
+  std::list<int> std_b = {8, 5, 2};
+  std_a.merge(std_b, std::greater<int>());
+  EXPECT_EQ(s21_a.size(), std_a.size());
+  EXPECT_TRUE(std::equal(std_a.begin(), std_a.end(), s21_a.begin()));
+  EXPECT_EQ(s21_a.back(), 1);
+
+  // the list stays usable from both ends
+  s21_a.push_back(0);
+  s21_b.push_back(7);
+  EXPECT_EQ(s21_a.back(), 0);
+  EXPECT_EQ(s21_b.front(), 7);
+}
+
+TEST(list_merge, stable) {
+  using Item = std::pair<int, int>;
+  auto by_first = [](const Item& a, const Item& b) {
+    return a.first < b.first;
+  };
+  s21::list<Item> s21_a = {{1, 0}, {2, 0}, {2, 1}, {5, 0}};
+  s21::list<Item> s21_b = {{0, 2}, {2, 2}, {5, 2}, {6, 2}};
+  s21_a.merge(s21_b, by_first);
+
+  std::list<Item> expected = {{0, 2}, {1, 0}, {2, 0}, {2, 1},
+                              {2, 2}, {5, 0}, {5, 2}, {6, 2}};
+  EXPECT_EQ(s21_a.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), s21_a.begin()));
+  EXPECT_EQ(s21_a.back(), Item(6, 2));
+}
+
+TEST(list_splice, element) {
+  s21::list<int> a = {1, 2, 3};
+  s21::list<int> b = {10, 20};
+  a.splice(a.end(), b, b.begin());
+  a.splice(a.begin(), b, b.begin());
+  EXPECT_TRUE(b.empty());
+  std::list<int> expected = {20, 1, 2, 3, 10};
+  EXPECT_EQ(a.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), a.begin()));
+
+  // within one list
+  a.splice(a.begin(), a, --a.end());
+  a.splice(a.end(), a, a.begin());
+  a.splice(a.begin(), a, a.begin());
+  expected = {20, 1, 2, 3, 10};
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), a.begin()));
+  EXPECT_EQ(a.back(), 10);
+  EXPECT_EQ(a.size(), 5);
+}
+
+TEST(list_splice, range) {
+  s21::list<int> a = {1, 2, 3};
+  s21::list<int> b = {10, 20, 30, 40};
+  auto first = ++b.begin();
+  auto last = --b.end();
+  a.splice(++a.begin(), b, first, last);
+  std::list<int> expected_a = {1, 20, 30, 2, 3};
+  std::list<int> expected_b = {10, 40};
+  EXPECT_EQ(a.size(), 5);
+  EXPECT_EQ(b.size(), 2);
+  EXPECT_TRUE(std::equal(expected_a.begin(), expected_a.end(), a.begin()));
+  EXPECT_TRUE(std::equal(expected_b.begin(), expected_b.end(), b.begin()));
+
+  // the whole of b, then a part of a to its own end
+  a.splice(a.begin(), b, b.begin(), b.end());
+  EXPECT_TRUE(b.empty());
+  a.splice(a.end(), a, a.begin(), ++++a.begin());
+  expected_a = {1, 20, 30, 2, 3, 10, 40};
+  EXPECT_EQ(a.size(), 7);
+  EXPECT_TRUE(std::equal(expected_a.begin(), expected_a.end(), a.begin()));
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.back(), 40);
+  a.splice(a.end(), a, a.begin(), a.end());
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.back(), 40);
+}
+
+TEST(list_sort, long_list) {
+  s21::list<int> a;
+  std::list<int> expected;
+  for (int i = 0; i < 200000; ++i) {
+    a.push_back((i * 7919) % 100003);
+    expected.push_back((i * 7919) % 100003);
+  }
+  a.sort();
+  expected.sort();
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), a.begin()));
+  EXPECT_EQ(a.back(), expected.back());
+}
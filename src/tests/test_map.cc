@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <random>
 #include <stdexcept>
+#include <string_view>
+#include <vector>
 
 #include "s21_containers.h"
 
@@ -647,3 +650,331 @@ TEST(MapInsertMany, test4) {
   ++it;
   ASSERT_EQ(it, s.end());
 }
+
+// Parallelism
+// --------------------------------
+TEST(MapParallel, copy_parallel) {
+  map<int, int> a;
+  for (int i = 0; i < 200000; ++i) a.insert(i, -i);
+
+  map<int, int> b = a.copy_parallel(4);
+  a.erase(0);
+
+  ASSERT_EQ(b.size(), 200000);
+  int expected = 0;
+  for (auto it = b.begin(); it != b.end(); ++it, ++expected) {
+    ASSERT_EQ(it->first, expected);
+    ASSERT_EQ(it->second, -expected);
+  }
+  b.insert(200000, 0);
+  ASSERT_EQ(b.size(), 200001);
+}
+
+TEST(MapParallel, copy_parallel_small) {
+  map<int, string> a{{1, "one"}, {2, "two"}};
+  map<int, string> b = a.copy_parallel(8);
+  map<int, string> c = map<int, string>().copy_parallel(8);
+
+  ASSERT_EQ(b.size(), 2);
+  ASSERT_EQ(b[2], "two");
+  ASSERT_TRUE(c.empty());
+}
+
+TEST(MapParallel, parallel_destruction) {
+  map<int, int> a;
+  a.set_parallel_destruction(4);
+  for (int i = 0; i < 200000; ++i) a.insert(i, i);
+  a.clear();
+  ASSERT_TRUE(a.empty());
+
+  for (int i = 0; i < 200000; ++i) a.insert(i, i);
+  ASSERT_EQ(a.size(), 200000);
+}
+
+// Heterogeneous lookup
+// --------------------------------
+TEST(MapTransparentLookup, string_view) {
+  map<string, int, std::less<>> a{{"one", 1}, {"two", 2}, {"three", 3}};
+  std::string_view key = "two";
+
+  ASSERT_EQ(a.find(key)->second, 2);
+  ASSERT_TRUE(a.contains("one"));
+  ASSERT_FALSE(a.contains("four"));
+  ASSERT_EQ(a.count(std::string_view("three")), 1);
+  ASSERT_EQ(a.at("three"), 3);
+  ASSERT_THROW(a.at("four"), std::out_of_range);
+  ASSERT_EQ(a.lower_bound("p")->first, "three");
+  ASSERT_EQ(a.upper_bound("three")->first, "two");
+  auto range = a.equal_range(key);
+  ASSERT_EQ(range.first->second, 2);
+  ASSERT_EQ(range.second, a.end());
+  range = a.equal_range("p");
+  ASSERT_EQ(range.first, range.second);
+
+  ASSERT_EQ(a.erase(key), 1);
+  ASSERT_EQ(a.erase("two"), 0);
+  ASSERT_EQ(a.size(), 2);
+}
+
+TEST(MapLookup, bounds) {
+  map<int, string> a{{1, "one"}, {3, "three"}, {5, "five"}};
+
+  ASSERT_EQ(a.lower_bound(0)->first, 1);
+  ASSERT_EQ(a.lower_bound(3)->first, 3);
+  ASSERT_EQ(a.upper_bound(3)->first, 5);
+  ASSERT_EQ(a.lower_bound(6), a.end());
+  ASSERT_EQ(a.upper_bound(5), a.end());
+  ASSERT_EQ(a.count(3), 1);
+  ASSERT_EQ(a.count(4), 0);
+}
+
+// Emplacement
+// --------------------------------
+struct Counted {
+  static int constructed;
+  Counted() { ++constructed; }
+  explicit Counted(int v) : value(v) { ++constructed; }
+  Counted(const Counted &other) : value(other.value) { ++constructed; }
+  int value = 0;
+};
+
+int Counted::constructed = 0;
+
+TEST(MapEmplace, try_emplace) {
+  map<int, Counted> a;
+  Counted::constructed = 0;
+
+  auto res = a.try_emplace(1, 10);
+  ASSERT_TRUE(res.second);
+  ASSERT_EQ(res.first->second.value, 10);
+  ASSERT_EQ(Counted::constructed, 1);
+
+  res = a.try_emplace(1, 20);
+  ASSERT_FALSE(res.second);
+  ASSERT_EQ(res.first->second.value, 10);
+  ASSERT_EQ(Counted::constructed, 1);
+
+  a[2].value = 5;
+  a[2].value += 1;
+  ASSERT_EQ(a.at(2).value, 6);
+  ASSERT_EQ(Counted::constructed, 2);
+}
+
+TEST(MapEmplace, try_emplace_move_key) {
+  map<string, string> a;
+  string key = "key";
+  a.try_emplace(std::move(key), 3, 'x');
+  ASSERT_EQ(a.at("key"), "xxx");
+}
+
+TEST(MapEmplace, emplace) {
+  map<int, string> a{{1, "one"}};
+  auto res = a.emplace(2, "two");
+  ASSERT_TRUE(res.second);
+  ASSERT_EQ(res.first->second, "two");
+
+  res = a.emplace(1, "uno");
+  ASSERT_FALSE(res.second);
+  ASSERT_EQ(res.first->second, "one");
+  ASSERT_EQ(a.size(), 2);
+}
+
+TEST(MapEmplace, insert_with_hint) {
+  map<int, int> a;
+  for (int i = 0; i < 1000; ++i) a.insert(a.end(), {i, i * 2});
+  for (int i = -1; i >= -1000; --i) a.emplace_hint(a.begin(), i, i * 2);
+
+  auto it = a.insert(a.find(500), {500, 0});
+  ASSERT_EQ(it->second, 1000);
+  it = a.insert(a.end(), {-5, 0});
+  ASSERT_EQ(it->second, -10);
+  it = a.insert(a.begin(), {2000, 7});
+  ASSERT_EQ(it->second, 7);
+
+  ASSERT_EQ(a.size(), 2001);
+  int expected = -1000;
+  for (auto jt = a.begin(); jt != a.end(); ++jt, ++expected) {
+    if (expected == 1000) expected = 2000;
+    ASSERT_EQ(jt->first, expected);
+  }
+}
+
+// Node handles
+// --------------------------------
+TEST(MapNodeHandle, move_between_maps) {
+  map<int, string> pending{{1, "one"}, {2, "two"}, {3, "three"}};
+  map<int, string> active{{5, "five"}};
+
+  const string *address = &pending.find(2)->second;
+  map<int, string>::node_type nh = pending.extract(2);
+  ASSERT_FALSE(nh.empty());
+  ASSERT_EQ(nh.key(), 2);
+  ASSERT_EQ(nh.mapped(), "two");
+  ASSERT_EQ(pending.size(), 2);
+  ASSERT_FALSE(pending.contains(2));
+
+  auto res = active.insert(std::move(nh));
+  ASSERT_TRUE(res.inserted);
+  ASSERT_TRUE(res.node.empty());
+  ASSERT_EQ(&res.position->second, address);
+  ASSERT_EQ(active.size(), 2);
+  ASSERT_EQ(active.at(2), "two");
+}
+
+TEST(MapNodeHandle, insert_duplicate_keeps_node) {
+  map<int, string> a{{1, "one"}, {2, "two"}};
+  map<int, string> b{{1, "uno"}};
+
+  auto res = b.insert(a.extract(a.begin()));
+  ASSERT_FALSE(res.inserted);
+  ASSERT_EQ(res.position->second, "uno");
+  ASSERT_FALSE(res.node.empty());
+  ASSERT_EQ(res.node.mapped(), "one");
+
+  res.node.mapped() = "ein";
+  a.insert(std::move(res.node));
+  ASSERT_EQ(a.at(1), "ein");
+  ASSERT_TRUE(a.extract(7).empty());
+}
+
+// Range removal
+// --------------------------------
+TEST(MapRangeErase, erase_range) {
+  map<int, int> m;
+  for (int i = 0; i < 10000; ++i) m.insert(i, i * 2);
+
+  auto last = m.erase(m.find(1000), m.find(9000));
+  ASSERT_EQ(last->first, 9000);
+  ASSERT_EQ(m.size(), 2000);
+  ASSERT_FALSE(m.contains(1000));
+  ASSERT_FALSE(m.contains(8999));
+  ASSERT_EQ(m.at(999), 1998);
+
+  int expected = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    if (expected == 1000) expected = 9000;
+    ASSERT_EQ(it->first, expected++);
+  }
+  ASSERT_EQ(expected, 10000);
+
+  ASSERT_EQ(m.erase(m.find(9500), m.end()), m.end());
+  ASSERT_EQ(m.size(), 1500);
+  ASSERT_EQ(m.erase(m.begin(), m.begin()), m.begin());
+  ASSERT_EQ(m.size(), 1500);
+  m.erase(m.begin(), m.end());
+  ASSERT_TRUE(m.empty());
+  m.insert(1, 1);
+  ASSERT_EQ(m.size(), 1);
+}
+
+TEST(MapRangeErase, erase_below_above) {
+  map<int, string> m;
+  for (int i = 0; i < 1000; i += 2) m.insert(i, std::to_string(i));
+
+  ASSERT_EQ(m.erase_below(101), 51);
+  ASSERT_EQ(m.begin()->first, 102);
+  ASSERT_EQ(m.erase_above(900), 49);
+  ASSERT_EQ(m.size(), 400);
+  ASSERT_EQ(m.erase_below(102), 0);
+  ASSERT_EQ(m.erase_above(900), 0);
+  ASSERT_EQ(m.at(900), "900");
+
+  for (int i = 0; i < 2000; ++i) m.insert_or_assign(i, "x");
+  ASSERT_EQ(m.size(), 2000);
+  ASSERT_EQ(m.erase_above(-1), 2000);
+  ASSERT_TRUE(m.empty());
+}
+
+TEST(MapRangeErase, erase_if) {
+  map<int, int> m;
+  for (int i = 0; i < 5000; ++i) m.insert(i, i % 3);
+
+  ASSERT_EQ(m.erase_if([](const std::pair<const int, int> &item) {
+    return item.second == 0;
+  }),
+            1667);
+  ASSERT_EQ(m.size(), 3333);
+  ASSERT_FALSE(m.contains(3));
+  ASSERT_TRUE(m.contains(4));
+  for (auto it = m.begin(); it != m.end(); ++it) ASSERT_NE(it->second, 0);
+
+  ASSERT_THROW(m.erase_if([](const std::pair<const int, int> &item) -> bool {
+    if (item.first > 2500) throw std::runtime_error("stop");
+    return item.first % 2 == 0;
+  }),
+               std::runtime_error);
+  ASSERT_FALSE(m.contains(4));
+  ASSERT_TRUE(m.contains(2501));
+  ASSERT_TRUE(m.contains(2504));
+  size_t count = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) ++count;
+  ASSERT_EQ(count, m.size());
+}
+
+// The overlap queries against a scan, while the tree changes by every
+// kind of modifier that moves nodes around
+TEST(MapInterval, overlapping_and_stabbing) {
+  using Range = s21::interval<int>;
+  map<Range, int> m;
+  std::mt19937 gen(11);
+  auto check = [&m, &gen]() {
+    for (int q = 0; q < 20; ++q) {
+      int lo = gen() % 11000 - 500;
+      int hi = q % 4 ? lo + gen() % 300 : lo;
+      std::vector<int> expected;
+      for (auto it = m.begin(); it != m.end(); ++it)
+        if (it->first.overlaps(lo, hi)) expected.push_back(it->second);
+      std::vector<int> found;
+      for (auto it : m.overlapping(lo, hi)) found.push_back(it->second);
+      ASSERT_EQ(found, expected);
+      if (lo == hi) {
+        ASSERT_EQ(m.stabbing(lo).size(), expected.size());
+      }
+    }
+  };
+  for (int i = 0; i < 3000; ++i) {
+    int lo = gen() % 10000;
+    m.insert({lo, lo + static_cast<int>(gen() % (i % 10 ? 50 : 2000))}, i);
+  }
+  check();
+  auto random_start = [&gen]() {
+    return Range{static_cast<int>(gen() % 10000), 0};
+  };
+  for (int i = 0; i < 1000; ++i) {
+    auto it = m.lower_bound(random_start());
+    if (it != m.end()) m.erase(it);
+  }
+  check();
+  map<Range, int> other;
+  for (int i = 0; i < 200; ++i) other.insert(m.extract(m.begin()));
+  for (int i = 0; i < 300; ++i) {
+    auto it = m.lower_bound(random_start());
+    if (it != m.end()) other.insert(m.extract(it));
+  }
+  check();
+  m.merge(other);
+  check();
+  m.erase_if([](const std::pair<const Range, int> &item) {
+    return item.first.hi - item.first.lo > 1000;
+  });
+  check();
+  map<Range, int> copy(m);
+  m = copy.copy_parallel(3);
+  check();
+  m.erase_below({5000, 0});
+  check();
+}
+
+TEST(MapInterval, edges) {
+  map<s21::interval<double>, string> m = {
+      {{1.0, 2.0}, "a"}, {{2.0, 3.0}, "b"}, {{5.0, 5.0}, "c"}};
+  // closed intervals: touching ends overlap
+  ASSERT_EQ(m.stabbing(2.0).size(), 2);
+  ASSERT_EQ(m.stabbing(4.0).size(), 0);
+  ASSERT_EQ(m.stabbing(5.0).front()->second, "c");
+  ASSERT_EQ(m.overlapping(3.0, 5.0).size(), 2);
+  ASSERT_TRUE(m.overlapping(3.5, 3.0).empty());
+  ASSERT_TRUE((map<s21::interval<int>, int>().stabbing(0).empty()));
+  m[{0.0, 10.0}] = "d";
+  ASSERT_EQ(m.stabbing(4.0).front()->second, "d");
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "s21_containersplus.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+using s21::mapped_vector;
+
+namespace {
+
+struct Record {
+  int id;
+  double value;
+};
+
+std::string TempPath(const std::string &name) {
+  std::string path = ::testing::TempDir() + "s21_" + name;
+  std::remove(path.c_str());
+  return path;
+}
+
+}  // namespace
+
+TEST(MappedVector, create_append_reopen) {
+  std::string path = TempPath("mapped_vector_records");
+  {
+    mapped_vector<Record> v(path);
+    ASSERT_TRUE(v.empty());
+    for (int i = 0; i < 10000; i++) v.push_back({i, i * 0.5});
+    v.insert_many_back(Record{-1, 1.0}, Record{-2, 2.0});
+    ASSERT_EQ(v.size(), 10002);
+    ASSERT_GE(v.capacity(), v.size());
+    v.flush();
+  }
+  {
+    mapped_vector<Record> v(path);
+    ASSERT_EQ(v.size(), 10002);
+    ASSERT_EQ(v.capacity(), 10002);
+    ASSERT_EQ(v.at(1234).id, 1234);
+    ASSERT_EQ(v[9999].value, 9999 * 0.5);
+    ASSERT_EQ(v.back().id, -2);
+    ASSERT_THROW(v.at(10002), std::out_of_range);
+
+    int sum = 0;
+    for (const Record &r : v) sum += r.id > 0;
+    ASSERT_EQ(sum, 9999);
+
+    v.pop_back();
+    v[0].id = 42;
+  }
+  mapped_vector<Record> v(path);
+  ASSERT_EQ(v.size(), 10001);
+  ASSERT_EQ(v.front().id, 42);
+  v.clear();
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 0);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVector, move_and_swap) {
+  std::string path_a = TempPath("mapped_vector_a");
+  std::string path_b = TempPath("mapped_vector_b");
+  mapped_vector<int> a(path_a);
+  mapped_vector<int> b(path_b);
+  a.insert_many_back(1, 2, 3);
+  b.push_back(7);
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1);
+  ASSERT_EQ(b.size(), 3);
+
+  mapped_vector<int> c(std::move(b));
+  ASSERT_EQ(c.at(2), 3);
+  ASSERT_TRUE(b.empty());
+  std::remove(path_a.c_str());
+  std::remove(path_b.c_str());
+}
+
+TEST(MappedVector, moved_from) {
+  std::string path = TempPath("mapped_vector_moved");
+  mapped_vector<int> a(path);
+  a.insert_many_back(1, 2);
+  mapped_vector<int> b(std::move(a));
+  ASSERT_EQ(a.size(), 0);
+  ASSERT_EQ(a.capacity(), 0);
+  ASSERT_EQ(a.begin(), a.end());
+  a.clear();
+  a.pop_back();
+  a.flush();
+  ASSERT_TRUE(a.empty());
+  ASSERT_THROW(a.push_back(3), std::runtime_error);
+
+  a = std::move(b);
+  ASSERT_EQ(a.size(), 2);
+  ASSERT_EQ(a.back(), 2);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVector, rejects_other_files) {
+  std::string path = TempPath("mapped_vector_bad");
+  { std::ofstream(path) << "definitely not a mapped vector, but long enough "
+                           "to have a whole header in it"; }
+  ASSERT_THROW(mapped_vector<int>{path}, std::runtime_error);
+
+  std::remove(path.c_str());
+  { mapped_vector<int>(path).push_back(1); }
+  ASSERT_THROW(mapped_vector<double>{path}, std::runtime_error);
+  ASSERT_EQ(mapped_vector<int>(path).at(0), 1);
+  std::remove(path.c_str());
+
+  ASSERT_THROW(mapped_vector<int>("/nonexistent/dir/file"),
+               std::system_error);
+}
+
+#endif  // defined(__unix__) || defined(__APPLE__)
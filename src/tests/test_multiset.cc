@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 
 #include "s21_containers.h"
 #include "s21_containersplus.h"
@@ -726,3 +729,140 @@ TEST(MultisetInsertMany, test4) {
   ++it;
   ASSERT_EQ(it, s.end());
 }
+
+TEST(MultisetParallel, copy_parallel) {
+  multiset<int> a;
+  a.set_parallel_destruction(3);
+  for (int i = 0; i < 200000; ++i) a.insert(i / 2);
+
+  multiset<int> b = a.copy_parallel(3);
+  a.clear();
+
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(b.size(), 200000);
+  ASSERT_EQ(b.count(99999), 2);
+  int i = 0;
+  for (auto it = b.begin(); it != b.end(); ++it, ++i) ASSERT_EQ(*it, i / 2);
+}
+
+TEST(MultisetTransparentLookup, string_view) {
+  multiset<std::string, std::less<>> a{"b", "a", "b", "c", "b"};
+  std::string_view key = "b";
+
+  ASSERT_EQ(a.count(key), 3);
+  ASSERT_EQ(*a.find(key), "b");
+  ASSERT_TRUE(a.contains("c"));
+  ASSERT_EQ(*a.lower_bound("aa"), "b");
+  ASSERT_EQ(*a.upper_bound(key), "c");
+  auto range = a.equal_range(key);
+  int n = 0;
+  for (auto it = range.first; it != range.second; ++it) ++n;
+  ASSERT_EQ(n, 3);
+
+  ASSERT_EQ(a.erase(key), 3);
+  ASSERT_EQ(a.size(), 2);
+}
+
+TEST(MultisetModifiers, bounds_of_absent_keys) {
+  multiset<int> empty;
+  ASSERT_EQ(empty.lower_bound(1), empty.end());
+  ASSERT_EQ(empty.upper_bound(1), empty.end());
+
+  multiset<int> a{1, 1, 5, 5, 9};
+  ASSERT_EQ(*a.lower_bound(3), 5);
+  ASSERT_EQ(*a.upper_bound(5), 9);
+  ASSERT_EQ(a.lower_bound(10), a.end());
+}
+
+TEST(MultisetNodeHandle, extract_insert) {
+  multiset<int> a{1, 2, 2, 3};
+  multiset<int> b{2};
+
+  auto nh = a.extract(2);
+  ASSERT_EQ(nh.value(), 2);
+  ASSERT_EQ(a.size(), 3);
+  ASSERT_EQ(a.count(2), 1);
+
+  b.insert(std::move(nh));
+  ASSERT_EQ(b.count(2), 2);
+
+  const int *address = &*a.find(3);
+  auto it = b.insert(a.extract(a.find(3)));
+  ASSERT_EQ(&*it, address);
+  ASSERT_EQ(a.size(), 2);
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_TRUE(a.extract(10).empty());
+}
+
+namespace {
+
+// std::less that throws while armed
+struct ArmedLess {
+  static inline bool armed = false;
+
+  bool operator()(int a, int b) const {
+    if (armed) throw std::runtime_error("compare");
+    return a < b;
+  }
+};
+
+}  // namespace
+
+TEST(MultisetNodeHandle, insert_with_throwing_compare) {
+  multiset<int, ArmedLess> a{1, 2, 2, 3};
+  multiset<int, ArmedLess> b{2, 4};
+  auto nh = a.extract(a.find(3));
+  ArmedLess::armed = true;
+  ASSERT_THROW(b.insert(std::move(nh)), std::runtime_error);
+  ArmedLess::armed = false;
+  // the handle still owns the node
+  ASSERT_FALSE(nh.empty());
+  ASSERT_EQ(b.size(), 2);
+  b.insert(std::move(nh));
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_EQ(b.count(3), 1);
+}
+
+TEST(MultisetRangeErase, erase_range) {
+  multiset<int> a{1, 2, 2, 2, 3, 4, 4, 5, 5, 5};
+
+  // [second 2, second 5) keeps one 2 and two 5s
+  auto first = a.find(2);
+  ++first;
+  auto last = a.find(5);
+  ++last;
+  auto it = a.erase(first, last);
+  ASSERT_EQ(*it, 5);
+  ASSERT_EQ(a.size(), 4);
+  ASSERT_EQ(a.count(2), 1);
+  ASSERT_EQ(a.count(3), 0);
+  ASSERT_EQ(a.count(5), 2);
+
+  // within one node
+  multiset<int> b{7, 7, 7, 7};
+  first = b.begin();
+  ++first;
+  last = first;
+  ++last;
+  ++last;
+  it = b.erase(first, last);
+  ASSERT_EQ(*it, 7);
+  ASSERT_EQ(b.size(), 2);
+  ASSERT_EQ(b.erase(b.begin(), b.end()), b.end());
+  ASSERT_TRUE(b.empty());
+}
+
+TEST(MultisetRangeErase, erase_if_below_above) {
+  multiset<int> a;
+  for (int i = 0; i < 1000; ++i) {
+    a.insert(i);
+    a.insert(i);
+  }
+  ASSERT_EQ(a.erase_below(100), 200);
+  ASSERT_EQ(a.erase_above(899), 200);
+  ASSERT_EQ(a.erase_if([](int x) { return x % 2 == 1; }), 800);
+  ASSERT_EQ(a.size(), 800);
+  ASSERT_EQ(*a.begin(), 100);
+  ASSERT_EQ(a.count(898), 2);
+  ASSERT_EQ(a.count(899), 0);
+}
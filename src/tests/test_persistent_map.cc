@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "s21_containersplus.h"
+
+using s21::persistent_map;
+using std::string;
+
+namespace {
+
+// Counts its instances; a copy throws once the budget of copies is spent
+struct Fragile {
+  static inline int live = 0;
+  static inline int copies_left = -1;
+
+  explicit Fragile(int v) : value(v) { ++live; }
+  Fragile(const Fragile &other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("copy");
+    if (copies_left > 0) --copies_left;
+    ++live;
+  }
+  ~Fragile() { --live; }
+
+  int value;
+};
+
+}  // namespace
+
+// Member functions
+// --------------------------------
+TEST(PersistentMapMemberFunctions, DefaultConstructor) {
+  persistent_map<int, string> a;
+  ASSERT_EQ(a.size(), 0);
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.begin(), a.end());
+}
+
+TEST(PersistentMapMemberFunctions, InitListConstructor) {
+  persistent_map<int, string> a{{1, "one"}, {2, "two"}, {3, "three"}};
+  ASSERT_EQ(a.size(), 3);
+  ASSERT_EQ(a.at(1), "one");
+  ASSERT_EQ(a.at(2), "two");
+  ASSERT_EQ(a.at(3), "three");
+  ASSERT_THROW(a.at(4), std::out_of_range);
+}
+
+TEST(PersistentMapMemberFunctions, MoveConstructor) {
+  persistent_map<int, string> a{{1, "one"}, {2, "two"}};
+  persistent_map<int, string> b = std::move(a);
+  ASSERT_EQ(a.size(), 0);
+  ASSERT_EQ(b.size(), 2);
+  ASSERT_EQ(b.at(2), "two");
+}
+
+// Snapshots
+// --------------------------------
+TEST(PersistentMapSnapshot, SharesNodes) {
+  persistent_map<int, string> a{{1, "one"}, {2, "two"}, {3, "three"}};
+  persistent_map<int, string> b = a.snapshot();
+
+  ASSERT_EQ(&*a.find(2), &*b.find(2));
+}
+
+TEST(PersistentMapSnapshot, OldVersionIsUnchanged) {
+  persistent_map<int, string> a{{1, "one"}, {2, "two"}, {3, "three"}};
+  persistent_map<int, string> b = a.snapshot();
+
+  a.insert(4, "four");
+  a.insert_or_assign(1, "uno");
+  a.erase(2);
+
+  ASSERT_EQ(a.size(), 3);
+  ASSERT_EQ(a.at(1), "uno");
+  ASSERT_FALSE(a.contains(2));
+  ASSERT_EQ(a.at(4), "four");
+
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_EQ(b.at(1), "one");
+  ASSERT_EQ(b.at(2), "two");
+  ASSERT_FALSE(b.contains(4));
+}
+
+TEST(PersistentMapSnapshot, UpdateCopiesOnlyPath) {
+  persistent_map<int, int> a;
+  for (int i = 0; i < 1000; ++i) a.insert(i, i);
+  persistent_map<int, int> b = a.snapshot();
+
+  a.insert_or_assign(999, -1);
+
+  int shared = 0;
+  for (auto it = a.begin(), jt = b.begin(); it != a.end(); ++it, ++jt)
+    if (&*it == &*jt) ++shared;
+  ASSERT_GE(shared, 1000 - 2 * 11);
+  ASSERT_EQ(b.at(999), 999);
+  ASSERT_EQ(a.at(999), -1);
+}
+
+TEST(PersistentMapSnapshot, ConcurrentReaders) {
+  persistent_map<int, int> a;
+  for (int i = 0; i < 1000; ++i) a.insert(i, i * i);
+  persistent_map<int, int> snap = a.snapshot();
+
+  std::thread reader([snap]() {
+    for (int round = 0; round < 10; ++round)
+      for (int i = 0; i < 1000; ++i) ASSERT_EQ(snap.at(i), i * i);
+  });
+  for (int i = 0; i < 1000; ++i) a.erase(i);
+  reader.join();
+
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(snap.size(), 1000);
+}
+
+// Modifiers
+// --------------------------------
+TEST(PersistentMapModifiers, insert) {
+  persistent_map<int, string> a;
+  auto res = a.insert(1, "one");
+  ASSERT_TRUE(res.second);
+  ASSERT_EQ(res.first->second, "one");
+
+  res = a.insert(1, "uno");
+  ASSERT_FALSE(res.second);
+  ASSERT_EQ(res.first->second, "one");
+  ASSERT_EQ(a.size(), 1);
+}
+
+TEST(PersistentMapModifiers, erase) {
+  persistent_map<int, string> a{{1, "one"}, {2, "two"}, {3, "three"}};
+  ASSERT_EQ(a.erase(5), 0);
+  ASSERT_EQ(a.erase(2), 1);
+  a.erase(a.begin());
+  ASSERT_EQ(a.size(), 1);
+  ASSERT_EQ(a.begin()->first, 3);
+}
+
+TEST(PersistentMapModifiers, throwing_copy) {
+  {
+    persistent_map<int, Fragile> a;
+    for (int i = 0; i < 100; ++i) a.insert(i, Fragile(i));
+    persistent_map<int, Fragile> b = a.snapshot();
+    for (int budget = 0; budget < 30; ++budget) {
+      Fragile::copies_left = budget;
+      try {
+        a.insert(100 + budget, Fragile(budget));
+        a.erase(budget);
+      } catch (const std::runtime_error &) {
+      }
+      Fragile::copies_left = -1;
+    }
+    size_t n = 0;
+    int prev = -1;
+    for (const auto &item : a) {
+      ASSERT_LT(prev, item.first);
+      prev = item.first;
+      ++n;
+    }
+    ASSERT_EQ(n, a.size());
+    ASSERT_EQ(b.size(), 100);
+  }
+  // nothing leaked
+  ASSERT_EQ(Fragile::live, 0);
+}
+
+TEST(PersistentMapModifiers, clear) {
+  persistent_map<int, string> a{{1, "one"}, {2, "two"}};
+  persistent_map<int, string> b = a.snapshot();
+  a.clear();
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(b.size(), 2);
+}
+
+TEST(PersistentMapExtraTests, CompareWithStdMap) {
+  persistent_map<int, int> a;
+  std::map<int, int> b;
+  for (int i = 0; i < 2000; ++i) {
+    int key = (i * 7919) % 503;
+    if (i % 3 == 0) {
+      a.erase(key);
+      b.erase(key);
+    } else {
+      a.insert_or_assign(key, i);
+      b[key] = i;
+    }
+  }
+  ASSERT_EQ(a.size(), b.size());
+  auto jt = b.begin();
+  for (auto it = a.begin(); it != a.end(); ++it, ++jt) {
+    ASSERT_EQ(it->first, jt->first);
+    ASSERT_EQ(it->second, jt->second);
+  }
+  auto it = a.end();
+  --it;
+  ASSERT_EQ(it->first, b.rbegin()->first);
+}
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include "s21_containersplus.h"
+
+using s21::persistent_set;
+
+TEST(PersistentSetMemberFunctions, InitListConstructor) {
+  persistent_set<int> a{3, 1, 2, 3};
+  ASSERT_EQ(a.size(), 3);
+  int expected = 1;
+  for (auto it = a.begin(); it != a.end(); ++it) ASSERT_EQ(*it, expected++);
+}
+
+TEST(PersistentSetSnapshot, OldVersionIsUnchanged) {
+  persistent_set<int> a{1, 2, 3};
+  persistent_set<int> b = a.snapshot();
+  persistent_set<int> c;
+  c = b;
+
+  a.insert(4);
+  b.erase(1);
+
+  ASSERT_EQ(a.size(), 4);
+  ASSERT_TRUE(a.contains(1));
+  ASSERT_TRUE(a.contains(4));
+  ASSERT_EQ(b.size(), 2);
+  ASSERT_FALSE(b.contains(1));
+  ASSERT_EQ(c.size(), 3);
+  ASSERT_TRUE(c.contains(1));
+  ASSERT_FALSE(c.contains(4));
+}
+
+TEST(PersistentSetModifiers, swap) {
+  persistent_set<int> a{1, 2};
+  persistent_set<int> b{5};
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1);
+  ASSERT_EQ(*a.find(5), 5);
+  ASSERT_EQ(b.size(), 2);
+  ASSERT_EQ(b.find(5), b.end());
+}
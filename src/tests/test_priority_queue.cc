@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <queue>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_containersplus.h"
+
+using s21::indexed_priority_queue;
+using s21::priority_queue;
+
+namespace {
+
+// Random pushes and pops, checked against std::priority_queue
+template <typename Queue>
+void CompareWithStd() {
+  Queue q;
+  std::priority_queue<int, std::vector<int>, std::greater<int>> expected;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 5000; ++i) {
+    if (expected.empty() || gen() % 3) {
+      int value = gen() % 1000;
+      q.push(value);
+      expected.push(value);
+    } else {
+      ASSERT_EQ(q.top(), expected.top());
+      q.pop();
+      expected.pop();
+    }
+    ASSERT_EQ(q.size(), expected.size());
+  }
+  for (; !expected.empty(); expected.pop(), q.pop())
+    ASSERT_EQ(q.top(), expected.top());
+  ASSERT_TRUE(q.empty());
+}
+
+}  // namespace
+
+TEST(PriorityQueue, create) {
+  priority_queue<int> q = {3, 1, 4, 1, 5, 9, 2, 6};
+  ASSERT_EQ(q.size(), 8);
+  ASSERT_EQ(q.top(), 9);
+
+  priority_queue<std::string, s21::vector<std::string>,
+                 std::greater<std::string>, 4>
+      s(std::greater<std::string>(), s21::vector<std::string>{"b", "c", "a"});
+  ASSERT_EQ(s.top(), "a");
+  s.emplace(2, 'a');
+  ASSERT_EQ(s.top(), "a");
+  s.pop();
+  ASSERT_EQ(s.top(), "aa");
+  s.insert_many_back("0", "z");
+  ASSERT_EQ(s.top(), "0");
+  ASSERT_EQ(s.size(), 5);
+}
+
+TEST(PriorityQueue, random_ops) {
+  CompareWithStd<priority_queue<int, s21::vector<int>, std::greater<int>>>();
+  CompareWithStd<
+      priority_queue<int, s21::vector<int>, std::greater<int>, 4>>();
+  CompareWithStd<priority_queue<int, s21::small_vector<int, 16>,
+                                std::greater<int>, 3>>();
+}
+
+TEST(PriorityQueue, swap) {
+  priority_queue<int> a = {1, 2};
+  priority_queue<int> b = {5};
+  a.swap(b);
+  ASSERT_EQ(a.top(), 5);
+  ASSERT_EQ(b.size(), 2);
+}
+
+TEST(IndexedPriorityQueue, update_and_erase) {
+  indexed_priority_queue<int, std::greater<int>, 4> q;
+  std::multiset<int> expected;
+  std::vector<size_t> handles;
+  std::mt19937 gen(11);
+  for (int i = 0; i < 3000; ++i) {
+    int value = gen() % 1000;
+    handles.push_back(q.push(value));
+    expected.insert(value);
+  }
+  for (int i = 0; i < 3000; ++i) {
+    size_t h = handles[gen() % handles.size()];
+    if (!q.contains(h)) continue;
+    expected.erase(expected.find(q[h]));
+    int value = gen() % 1000;
+    if (i % 3 == 0) {
+      q.erase(h);
+      continue;
+    }
+    if (i % 3 == 1 && value < q[h])
+      q.decrease_key(h, value);
+    else
+      q.update(h, value);
+    expected.insert(value);
+    ASSERT_EQ(q[h], value);
+  }
+  ASSERT_EQ(q.size(), expected.size());
+  for (int value : expected) {
+    ASSERT_EQ(q.top(), value);
+    ASSERT_EQ(q[q.top_handle()], value);
+    q.pop();
+  }
+  ASSERT_TRUE(q.empty());
+  ASSERT_THROW(q.erase(handles[0]), std::out_of_range);
+}
+
+TEST(IndexedPriorityQueue, handles_are_reused) {
+  indexed_priority_queue<std::string> q;
+  size_t a = q.push("a");
+  size_t b = q.push("b");
+  ASSERT_EQ(q.top_handle(), b);
+  q.pop();
+  ASSERT_FALSE(q.contains(b));
+  ASSERT_EQ(q.emplace(3, 'c'), b);
+  ASSERT_EQ(q.top(), "ccc");
+  q.update(a, "d");
+  ASSERT_EQ(q.top_handle(), a);
+  q.clear();
+  ASSERT_TRUE(q.empty());
+  ASSERT_FALSE(q.contains(a));
+}
+
+TEST(IndexedPriorityQueue, dijkstra) {
+  // edges of a small graph: from, to, weight
+  std::vector<std::vector<std::pair<int, int>>> graph(5);
+  int edges[][3] = {{0, 1, 4}, {0, 2, 1}, {2, 1, 2}, {1, 3, 1},
+                    {2, 3, 5}, {3, 4, 3}, {0, 4, 20}};
+  for (auto &e : edges) graph[e[0]].push_back({e[1], e[2]});
+
+  indexed_priority_queue<int, std::greater<int>> q;
+  std::vector<size_t> handle(5);
+  std::vector<int> dist(5, 1000);
+  for (int v = 0; v < 5; ++v) handle[v] = q.push(v ? 1000 : 0);
+  dist[0] = 0;
+  std::vector<int> vertex(5);
+  for (int v = 0; v < 5; ++v) vertex[handle[v]] = v;
+  while (!q.empty()) {
+    int u = vertex[q.top_handle()];
+    q.pop();
+    for (auto [v, w] : graph[u]) {
+      if (dist[u] + w < dist[v]) {
+        dist[v] = dist[u] + w;
+        q.decrease_key(handle[v], dist[v]);
+      }
+    }
+  }
+  ASSERT_EQ(dist, std::vector<int>({0, 3, 1, 4, 7}));
+}
@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "s21_containersplus.h"
+#include "tests/test_util.h"
+
+using s21::radix_map;
+
+namespace {
+
+// Strings with long shared prefixes, prefixes of each other and bytes
+// above 127
+std::string RandomKey(std::mt19937 &gen) {
+  static const std::string kStarts[] = {"", "a", "ab", "abc",
+                                        "https://example.com/users/"};
+  std::string key = kStarts[gen() % 5];
+  for (int n = gen() % 4; n > 0; --n)
+    key += static_cast<char>(gen() % 3 ? 'a' + gen() % 3 : 0xF0 + gen() % 3);
+  return key;
+}
+
+// Counts its instances; a copy throws once the budget of copies is spent
+struct Fragile {
+  static inline int live = 0;
+  static inline int copies_left = -1;
+
+  explicit Fragile(int v) : value(v) { ++live; }
+  Fragile(const Fragile &other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("copy");
+    if (copies_left > 0) --copies_left;
+    ++live;
+  }
+  ~Fragile() { --live; }
+
+  int value;
+};
+
+}  // namespace
+
+TEST(RadixMap, random_string_ops) {
+  radix_map<std::string, int> m;
+  std::map<std::string, int> expected;
+  std::mt19937 gen(5);
+  for (int i = 0; i < 30000; ++i) {
+    std::string key = RandomKey(gen);
+    switch (gen() % 5) {
+      case 0:
+        ASSERT_EQ(m.erase(key), expected.erase(key));
+        break;
+      case 1: {
+        auto it = m.lower_bound(key);
+        auto expected_it = expected.lower_bound(key);
+        if (expected_it == expected.end()) {
+          ASSERT_EQ(it, m.end());
+        } else {
+          ASSERT_EQ(*it, *expected_it);
+          auto next = m.erase(it);
+          expected_it = expected.erase(expected_it);
+          if (expected_it == expected.end())
+            ASSERT_EQ(next, m.end());
+          else
+            ASSERT_EQ(*next, *expected_it);
+        }
+        break;
+      }
+      case 2: {
+        auto it = m.upper_bound(key);
+        auto expected_it = expected.upper_bound(key);
+        if (expected_it == expected.end())
+          ASSERT_EQ(it, m.end());
+        else
+          ASSERT_EQ(*it, *expected_it);
+        break;
+      }
+      default:
+        ASSERT_EQ(m.insert(key, i).second, expected.insert({key, i}).second);
+    }
+    ASSERT_EQ(m.contains(key), expected.count(key) == 1);
+  }
+  ExpectEqual(m, expected);
+  while (!expected.empty()) {
+    ASSERT_EQ(m.erase(expected.begin()->first), 1);
+    expected.erase(expected.begin());
+  }
+  ASSERT_TRUE(m.empty());
+  ASSERT_EQ(m.begin(), m.end());
+}
+
+TEST(RadixMap, integer_keys) {
+  // negative numbers go before the positive ones; enough keys under one
+  // byte to grow the nodes to 256 children and back
+  radix_map<int64_t, int> m;
+  std::map<int64_t, int> expected;
+  std::mt19937_64 gen(7);
+  for (int i = 0; i < 20000; ++i) {
+    int64_t key = i % 2 ? static_cast<int64_t>(gen()) : i - 10000;
+    m[key] = i;
+    expected[key] = i;
+  }
+  ExpectEqual(m, expected);
+  ASSERT_EQ(m.lower_bound(-10001)->first, expected.lower_bound(-10001)->first);
+  ASSERT_EQ(m.upper_bound(-2)->first, 0);
+  for (int64_t key = -10000; key < 10000; key += 2) ASSERT_EQ(m.erase(key), 1);
+  for (auto it = expected.begin(); it != expected.end();)
+    it = it->first >= -10000 && it->first < 10000 && it->first % 2 == 0
+             ? expected.erase(it)
+             : std::next(it);
+  ExpectEqual(m, expected);
+  // the nodes shrink back on the way down
+  std::vector<int64_t> keys;
+  for (const auto &item : expected) keys.push_back(item.first);
+  std::shuffle(keys.begin(), keys.end(), gen);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ASSERT_EQ(m.erase(keys[i]), 1);
+    expected.erase(keys[i]);
+    if (i % 1000 == 0) ExpectEqual(m, expected);
+  }
+  ASSERT_TRUE(m.empty());
+  ASSERT_EQ(m.find(keys[0]), m.end());
+
+  radix_map<uint8_t, int> bytes;
+  for (int i = 255; i >= 0; --i) bytes[static_cast<uint8_t>(i)] = i;
+  ASSERT_EQ(bytes.size(), 256);
+  ASSERT_EQ(bytes.begin()->first, 0);
+  ASSERT_EQ((--bytes.end())->first, 255);
+}
+
+TEST(RadixMap, prefix_range) {
+  radix_map<std::string, int> m = {
+      {"https://a.org/", 0},      {"https://a.org/x", 1},
+      {"https://a.org/x/y", 2},   {"https://a.org/xz", 3},
+      {"https://b.org/x", 4},     {"https://a.org/w", 5},
+      {"http://a.org/x", 6},      {"https://a.org/x/yyyyyyyyyy", 7}};
+  auto keys = [](auto range) {
+    std::vector<int> res;
+    for (auto it = range.first; it != range.second; ++it)
+      res.push_back(it->second);
+    return res;
+  };
+  ASSERT_EQ(keys(m.prefix_range("https://a.org/x")),
+            std::vector<int>({1, 2, 7, 3}));
+  ASSERT_EQ(keys(m.prefix_range("https://a.org/x/")),
+            std::vector<int>({2, 7}));
+  ASSERT_EQ(keys(m.prefix_range("https://")),
+            std::vector<int>({0, 5, 1, 2, 7, 3, 4}));
+  ASSERT_EQ(keys(m.prefix_range("")).size(), 8);
+  ASSERT_TRUE(keys(m.prefix_range("https://c")).empty());
+  ASSERT_TRUE(keys(m.prefix_range("https://a.org/x/yz")).empty());
+  ASSERT_EQ(keys(m.prefix_range("https://a.org/x/yyyyyyyyyy")),
+            std::vector<int>({7}));
+
+  // a range query
+  std::vector<int> between;
+  for (auto it = m.lower_bound("https://a.org/w");
+       it != m.upper_bound("https://a.org/xz"); ++it)
+    between.push_back(it->second);
+  ASSERT_EQ(between, std::vector<int>({5, 1, 2, 7, 3}));
+}
+
+TEST(RadixMap, map_api) {
+  radix_map<std::string, int> m = {{"one", 1}, {"two", 2}};
+  ASSERT_EQ(m.at("one"), 1);
+  ASSERT_THROW(m.at("three"), std::out_of_range);
+  ASSERT_THROW(m.at("on"), std::out_of_range);
+  m["three"] = 3;
+  ASSERT_EQ(m.size(), 3);
+  ASSERT_FALSE(m.insert("one", 10).second);
+  m.insert_or_assign("one", 10);
+  ASSERT_EQ(m["one"], 10);
+  ASSERT_TRUE(m.insert({"", 0}).second);
+  ASSERT_EQ(m.begin()->first, "");
+  ASSERT_EQ(m.try_emplace("five", 5).first->second, 5);
+  ASSERT_EQ(m.count("five"), 1);
+  ASSERT_EQ(m.find("fiv"), m.end());
+
+  radix_map<std::string, int> copy(m);
+  ExpectEqual(copy, std::map<std::string, int>(m.begin(), m.end()));
+  radix_map<std::string, int> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(moved.size(), 5);
+  copy = moved;
+  copy.clear();
+  ASSERT_TRUE(copy.empty());
+  copy.swap(moved);
+  ASSERT_EQ(copy.size(), 5);
+  const auto &cm = copy;
+  ASSERT_EQ(cm.at("two"), 2);
+  ASSERT_EQ(cm.find("two")->second, 2);
+}
+
+TEST(RadixMap, throwing_copy) {
+  {
+    using FragileMap = radix_map<std::string, Fragile>;
+    FragileMap m;
+    for (int i = 0; i < 100; ++i) m.try_emplace(std::to_string(i), i);
+    Fragile::copies_left = 50;
+    ASSERT_THROW(FragileMap{m}, std::runtime_error);
+    Fragile::copies_left = 0;
+    ASSERT_THROW((FragileMap{{"a", Fragile(1)}}), std::runtime_error);
+    Fragile::copies_left = -1;
+    ASSERT_EQ(Fragile::live, 100);
+  }
+  ASSERT_EQ(Fragile::live, 0);
+}
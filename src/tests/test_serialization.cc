@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "s21_containersplus.h"
+
+using s21::deserialize;
+using s21::serialize;
+
+namespace {
+
+struct Point {
+  int x;
+  double y;
+};
+
+enum class Color : uint16_t { kRed = 1, kBlue = 0x0102 };
+
+// Serializes value into a buffer and reads it back
+template <typename T>
+T RoundTrip(const T &value) {
+  s21::vector<unsigned char> buffer;
+  serialize(value, &buffer);
+  T result;
+  size_t consumed = deserialize(buffer.begin(), buffer.size(), &result);
+  EXPECT_EQ(consumed, buffer.size());
+  return result;
+}
+
+}  // namespace
+
+TEST(Serialization, little_endian) {
+  s21::vector<unsigned char> buffer;
+  serialize(uint32_t(0x01020304), &buffer);
+  serialize(Color::kBlue, &buffer);
+  ASSERT_EQ(buffer.size(), 6);
+  unsigned char expected[] = {4, 3, 2, 1, 2, 1};
+  for (size_t i = 0; i < buffer.size(); ++i) ASSERT_EQ(buffer[i], expected[i]);
+
+  uint32_t n = 0;
+  ASSERT_EQ(deserialize(buffer.begin(), buffer.size(), &n), 4);
+  ASSERT_EQ(n, 0x01020304u);
+}
+
+TEST(Serialization, vector) {
+  s21::vector<int> v;
+  for (int i = -500; i < 500; ++i) v.push_back(i * 7);
+  s21::vector<int> v2 = RoundTrip(v);
+  ASSERT_EQ(v2.size(), v.size());
+  for (size_t i = 0; i < v.size(); ++i) ASSERT_EQ(v2[i], v[i]);
+
+  s21::vector<std::string> s = {"", "a", std::string(1000, 'x')};
+  s21::vector<std::string> s2 = RoundTrip(s);
+  ASSERT_EQ(s2.size(), 3);
+  ASSERT_EQ(s2[0], "");
+  ASSERT_EQ(s2[2], s[2]);
+
+  s21::vector<Point> p = {{1, 0.5}, {2, -1.5}};
+  s21::vector<Point> p2 = RoundTrip(p);
+  ASSERT_EQ(p2[1].x, 2);
+  ASSERT_EQ(p2[1].y, -1.5);
+
+  ASSERT_TRUE(RoundTrip(s21::vector<double>()).empty());
+}
+
+TEST(Serialization, list) {
+  s21::list<std::string> l = {"one", "two", "three"};
+  s21::list<std::string> l2 = RoundTrip(l);
+  ASSERT_EQ(l2.size(), 3);
+  auto it = l2.begin();
+  ASSERT_EQ(*it, "one");
+  ASSERT_EQ(*++it, "two");
+  ASSERT_EQ(*++it, "three");
+}
+
+TEST(Serialization, set_and_multiset) {
+  s21::set<int> s;
+  for (int i = 0; i < 1000; ++i) s.insert((i * 37) % 1000);
+  s21::set<int> s2 = RoundTrip(s);
+  ASSERT_EQ(s2.size(), 1000);
+  int expected = 0;
+  for (int x : s2) ASSERT_EQ(x, expected++);
+  s2.insert(1000);
+  ASSERT_TRUE(s2.contains(999));
+  ASSERT_TRUE(s2.contains(1000));
+
+  s21::multiset<int> m = {3, 1, 3, 2, 3};
+  s21::multiset<int> m2 = RoundTrip(m);
+  ASSERT_EQ(m2.size(), 5);
+  ASSERT_EQ(m2.count(3), 3);
+  ASSERT_EQ(m2.count(1), 1);
+}
+
+TEST(Serialization, map) {
+  s21::map<std::string, s21::vector<int>> m;
+  m.insert("b", {1, 2});
+  m.insert("a", {});
+  m.insert("c", {3});
+  s21::map<std::string, s21::vector<int>> m2 = RoundTrip(m);
+  ASSERT_EQ(m2.size(), 3);
+  ASSERT_TRUE(m2.at("a").empty());
+  ASSERT_EQ(m2.at("b").size(), 2);
+  ASSERT_EQ(m2.at("b")[1], 2);
+  ASSERT_EQ(m2.at("c")[0], 3);
+  ASSERT_EQ(m2.begin()->first, "a");
+}
+
+TEST(Serialization, stream) {
+  s21::map<int, std::string> m = {{1, "one"}, {2, "two"}};
+  s21::vector<double> v = {0.25, 0.5};
+  std::stringstream ss;
+  serialize(m, ss);
+  serialize(v, ss);
+
+  s21::map<int, std::string> m2;
+  s21::vector<double> v2;
+  deserialize(ss, &m2);
+  deserialize(ss, &v2);
+  ASSERT_EQ(m2.size(), 2);
+  ASSERT_EQ(m2.at(2), "two");
+  ASSERT_EQ(v2.size(), 2);
+  ASSERT_EQ(v2[1], 0.5);
+
+  ASSERT_THROW(deserialize(ss, &v2), std::runtime_error);
+}
+
+TEST(Serialization, truncated) {
+  s21::vector<unsigned char> buffer;
+  serialize(s21::set<int>({1, 2, 3}), &buffer);
+  s21::set<int> s = {7};
+  for (size_t n = 0; n < buffer.size(); ++n)
+    ASSERT_THROW(deserialize(buffer.begin(), n, &s), std::runtime_error);
+  ASSERT_EQ(s.size(), 1);
+
+  // a corrupt length is rejected before anything is allocated
+  s21::vector<unsigned char> huge(8);
+  for (unsigned char &byte : huge) byte = 0xff;
+  s21::vector<int> v;
+  ASSERT_THROW(deserialize(huge.begin(), huge.size(), &v), std::runtime_error);
+  std::stringstream ss(std::string(8, '\xff'));
+  ASSERT_THROW(deserialize(ss, &v), std::runtime_error);
+  // one string of 64 GiB, as far as the stream tells
+  std::string bytes("\x01\0\0\0\0\0\0\0\0\0\0\0\x10\0\0\0abc", 19);
+  std::stringstream strings(bytes);
+  s21::vector<std::string> sv;
+  ASSERT_THROW(deserialize(strings, &sv), std::runtime_error);
+}
+
+TEST(Serialization, unsorted) {
+  s21::vector<unsigned char> buffer;
+  serialize(s21::vector<int>({1, 3, 2}), &buffer);
+  s21::set<int> s;
+  ASSERT_THROW(deserialize(buffer.begin(), buffer.size(), &s),
+               std::invalid_argument);
+  s21::multiset<int> m;
+  ASSERT_THROW(deserialize(buffer.begin(), buffer.size(), &m),
+               std::invalid_argument);
+
+  // duplicates are fine for a multiset only
+  buffer.clear();
+  serialize(s21::vector<int>({1, 1, 2}), &buffer);
+  ASSERT_THROW(deserialize(buffer.begin(), buffer.size(), &s),
+               std::invalid_argument);
+  deserialize(buffer.begin(), buffer.size(), &m);
+  ASSERT_EQ(m.count(1), 2);
+}
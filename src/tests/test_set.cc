@@ -1,7 +1,10 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "s21_containers.h"
 
@@ -471,6 +474,23 @@ TEST(SetExtraTests, insert_iterate_remove) {
   ASSERT_TRUE(s.empty());
 }
 
+TEST(SetExtraTests, large_sorted_insert_copy_erase) {
+  const int n = 100000;
+  set<int> s;
+  for (int i = 0; i < n; ++i) s.insert(i);
+
+  set<int> copy = s;
+  for (int i = 0; i < n; i += 2) copy.erase(copy.find(i));
+  for (int i = 0; i < n; i += 2) copy.insert(i);
+  for (int i = 1; i < n; i += 2) copy.erase(copy.find(i));
+
+  ASSERT_EQ(s.size(), n);
+  ASSERT_EQ(copy.size(), n / 2);
+  int expected = 0;
+  for (auto it = copy.begin(); it != copy.end(); ++it, expected += 2)
+    ASSERT_EQ(*it, expected);
+}
+
 using s21::vector;
 
 TEST(SetInsertMany, test1) {
@@ -600,3 +620,140 @@ TEST(SetInsertMany, test4) {
   ++it;
   ASSERT_EQ(it, s.end());
 }
+
+struct Person {
+  int id;
+  std::string name;
+};
+
+// Orders people by id and compares them with plain ids
+struct ById {
+  using is_transparent = void;
+  bool operator()(const Person &a, const Person &b) const {
+    return a.id < b.id;
+  }
+  bool operator()(const Person &a, int id) const { return a.id < id; }
+  bool operator()(int id, const Person &b) const { return id < b.id; }
+};
+
+TEST(SetTransparentLookup, lookup_by_id) {
+  set<Person, ById> a{{3, "Ann"}, {1, "Bob"}, {2, "Eve"}};
+
+  ASSERT_EQ(a.find(2)->name, "Eve");
+  ASSERT_TRUE(a.contains(3));
+  ASSERT_FALSE(a.contains(4));
+  ASSERT_EQ(a.count(1), 1);
+  ASSERT_EQ(a.lower_bound(2)->name, "Eve");
+  ASSERT_EQ(a.upper_bound(2)->name, "Ann");
+  auto range = a.equal_range(2);
+  ASSERT_EQ(range.first->name, "Eve");
+  ASSERT_EQ(range.second->name, "Ann");
+  range = a.equal_range(0);
+  ASSERT_EQ(range.first, a.begin());
+  ASSERT_EQ(range.second, a.begin());
+
+  ASSERT_EQ(a.erase(1), 1);
+  ASSERT_EQ(a.begin()->name, "Eve");
+  ASSERT_EQ(a.size(), 2);
+}
+
+TEST(SetModifiers, erase_key) {
+  set<int> a{1, 2, 3};
+  ASSERT_EQ(a.erase(2), 1);
+  ASSERT_EQ(a.erase(2), 0);
+  ASSERT_EQ(a.size(), 2);
+  ASSERT_FALSE(a.contains(2));
+}
+
+TEST(SetModifiers, emplace_hint) {
+  set<std::string> a;
+  auto it = a.emplace_hint(a.end(), 3, 'a');
+  ASSERT_EQ(*it, "aaa");
+  a.emplace_hint(a.end(), "b");
+  a.emplace_hint(a.begin(), "a");
+  auto res = a.emplace("b");
+  ASSERT_FALSE(res.second);
+
+  ASSERT_EQ(a.size(), 3);
+  it = a.begin();
+  ASSERT_EQ(*it, "a");
+  ++it;
+  ASSERT_EQ(*it, "aaa");
+  ++it;
+  ASSERT_EQ(*it, "b");
+}
+
+TEST(SetNodeHandle, move_between_sets) {
+  set<int> a{1, 2, 3};
+  set<int> b;
+
+  const int *address = &*a.find(3);
+  auto nh = a.extract(a.find(3));
+  ASSERT_EQ(nh.value(), 3);
+  auto res = b.insert(std::move(nh));
+  ASSERT_TRUE(res.inserted);
+  ASSERT_EQ(&*res.position, address);
+  ASSERT_EQ(a.size(), 2);
+  ASSERT_EQ(b.size(), 1);
+
+  auto empty = b.insert(set<int>::node_type());
+  ASSERT_FALSE(empty.inserted);
+  ASSERT_EQ(empty.position, b.end());
+}
+
+TEST(SetRangeErase, erase_range_and_bounds) {
+  set<int> s;
+  for (int i = 0; i < 3000; ++i) s.insert(i);
+
+  auto it = s.erase(s.lower_bound(100), s.upper_bound(199));
+  ASSERT_EQ(*it, 200);
+  ASSERT_EQ(s.size(), 2900);
+  ASSERT_EQ(s.erase_below(50), 50);
+  ASSERT_EQ(s.erase_above(2949), 50);
+  ASSERT_EQ(s.erase_if([](int x) { return x % 10 != 0; }), 2520);
+  ASSERT_EQ(s.size(), 280);
+
+  int expected = 50;
+  for (auto i = s.begin(); i != s.end(); ++i) {
+    if (expected == 100) expected = 200;
+    ASSERT_EQ(*i, expected);
+    expected += 10;
+  }
+  ASSERT_EQ(expected, 2950);
+}
+
+TEST(SetAssignSorted, build_and_reject) {
+  set<int> s = {-1};
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(i * 2);
+  s.assign_sorted(keys.begin(), keys.end());
+  ASSERT_EQ(s.size(), 1000);
+  ASSERT_FALSE(s.contains(-1));
+  ASSERT_TRUE(s.contains(998));
+  ASSERT_EQ(*s.lower_bound(999), 1000);
+  s.insert(1);
+  auto it = s.begin();
+  ++it;
+  ASSERT_EQ(*it, 1);
+
+  keys = {1, 2, 2};
+  ASSERT_THROW(s.assign_sorted(keys.begin(), keys.end()),
+               std::invalid_argument);
+  ASSERT_EQ(s.size(), 1001);
+}
+
+TEST(SetInterval, overlapping) {
+  set<s21::interval<int>> s;
+  for (int i = 0; i < 1000; ++i) s.insert({i * 10, i * 10 + (i % 7) * 10});
+  auto found = s.overlapping(100, 115);
+  std::vector<std::pair<int, int>> ranges;
+  for (auto it : found) ranges.emplace_back(it->lo, it->hi);
+  std::vector<std::pair<int, int>> expected;
+  for (auto it = s.begin(); it != s.end(); ++it)
+    if ((*it).overlaps(100, 115)) expected.emplace_back((*it).lo, (*it).hi);
+  ASSERT_EQ(ranges, expected);
+  ASSERT_EQ(ranges.front(), std::make_pair(50, 100));
+  s.erase(s.find({50, 100}));
+  ASSERT_EQ(s.overlapping(100, 115).size(), expected.size() - 1);
+  ASSERT_EQ(s.stabbing(-1).size(), 0);
+}
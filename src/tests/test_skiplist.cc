@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_containersplus.h"
+#include "tests/test_util.h"
+
+using s21::skiplist_map;
+using s21::skiplist_set;
+
+TEST(SkipListSet, random_ops) {
+  for (double p : {0.25, 0.5, 0.9}) {
+    skiplist_set<int> s(p);
+    ASSERT_EQ(s.probability(), p);
+    std::set<int> expected;
+    std::mt19937 gen(13);
+    for (int i = 0; i < 20000; ++i) {
+      int key = gen() % 2000;
+      switch (gen() % 4) {
+        case 0:
+          ASSERT_EQ(s.erase(key), expected.erase(key));
+          break;
+        case 1: {
+          auto it = s.lower_bound(key);
+          auto expected_it = expected.lower_bound(key);
+          if (expected_it == expected.end()) {
+            ASSERT_EQ(it, s.end());
+          } else {
+            ASSERT_EQ(*it, *expected_it);
+            auto next = s.erase(it);
+            expected_it = expected.erase(expected_it);
+            if (expected_it == expected.end())
+              ASSERT_EQ(next, s.end());
+            else
+              ASSERT_EQ(*next, *expected_it);
+          }
+          break;
+        }
+        default:
+          ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+      }
+      ASSERT_EQ(s.contains(key), expected.count(key) == 1);
+    }
+    ExpectEqual(s, expected);
+  }
+}
+
+TEST(SkipListSet, ascending_inserts) {
+  // mostly ascending keys go through the finger, with some jumps back
+  skiplist_set<int> s;
+  std::set<int> expected;
+  for (int i = 0; i < 30000; ++i) {
+    int key = i % 1000 == 999 ? i / 2 : i;
+    s.insert(key);
+    expected.insert(key);
+  }
+  ExpectEqual(s, expected);
+  ASSERT_EQ(*s.upper_bound(100), 101);
+  ASSERT_EQ(s.find(30000), s.end());
+  ASSERT_EQ(s.count(29998), 1);
+  ASSERT_EQ(s.count(29999), 0);
+
+  skiplist_set<int> copy(s);
+  ExpectEqual(copy, expected);
+  copy.clear();
+  ASSERT_TRUE(copy.empty());
+  copy.insert(5);
+  ASSERT_EQ(*copy.begin(), 5);
+}
+
+TEST(SkipListSet, create_swap_merge) {
+  skiplist_set<std::string> a = {"b", "a", "c"};
+  ASSERT_EQ(*a.begin(), "a");
+  ASSERT_THROW(skiplist_set<int>(1.0), std::invalid_argument);
+  ASSERT_THROW(skiplist_set<int>(0.0), std::invalid_argument);
+
+  skiplist_set<std::string> b = {"c", "d"};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 4);
+  ASSERT_EQ(b.size(), 1);
+  ASSERT_EQ(*b.begin(), "c");
+
+  skiplist_set<std::string> moved(std::move(a));
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(moved.size(), 4);
+  a = moved;
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1);
+  ASSERT_EQ(*--b.end(), "d");
+  b.emplace(3, 'e');
+  ASSERT_EQ(*--b.end(), "eee");
+  auto res = b.insert_many("f", "a");
+  ASSERT_TRUE(res[0].second);
+  ASSERT_FALSE(res[1].second);
+}
+
+TEST(SkipListMap, map_api) {
+  skiplist_map<std::string, int> m = {{"one", 1}, {"two", 2}};
+  ASSERT_EQ(m.at("one"), 1);
+  ASSERT_THROW(m.at("three"), std::out_of_range);
+  m["three"] = 3;
+  ASSERT_EQ(m.size(), 3);
+  ASSERT_FALSE(m.insert("one", 10).second);
+  ASSERT_EQ(m["one"], 1);
+  m.insert_or_assign("one", 10);
+  ASSERT_EQ(m["one"], 10);
+  ASSERT_TRUE(m.insert({"four", 4}).second);
+  ASSERT_EQ(m.try_emplace("five", 5).first->second, 5);
+
+  std::map<std::string, int> expected = {
+      {"five", 5}, {"four", 4}, {"one", 10}, {"three", 3}, {"two", 2}};
+  ASSERT_TRUE(std::equal(m.begin(), m.end(), expected.begin()));
+  for (auto &item : m) item.second *= 2;
+  ASSERT_EQ(m.at("two"), 4);
+  const auto &cm = m;
+  ASSERT_EQ(cm.at("four"), 8);
+  ASSERT_EQ(m.erase("four"), 1);
+  ASSERT_FALSE(m.contains("four"));
+}
+
+// Readers look the keys up while one thread inserts them
+TEST(SkipListSet, concurrent_readers) {
+  const int kKeys = 20000;
+  skiplist_set<int> s;
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; ++t) {
+    readers.emplace_back([&s, &done] {
+      while (!done.load()) {
+        int last = -1;
+        for (auto it = s.lower_bound(kKeys / 2); it != s.end(); ++it) {
+          ASSERT_LT(last, *it);
+          last = *it;
+        }
+        s.contains(kKeys - 1);
+      }
+    });
+  }
+  std::mt19937 gen(2);
+  std::vector<int> keys(kKeys);
+  for (int i = 0; i < kKeys; ++i) keys[i] = i;
+  std::shuffle(keys.begin(), keys.end(), gen);
+  for (int key : keys) s.insert(key);
+  done = true;
+  for (std::thread &reader : readers) reader.join();
+  ASSERT_EQ(s.size(), kKeys);
+}
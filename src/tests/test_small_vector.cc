@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "s21_containersplus.h"
+
+using s21::small_vector;
+
+TEST(CreateSmallVector, default_is_inline) {
+  small_vector<int, 4> v;
+  ASSERT_TRUE(v.empty());
+  ASSERT_TRUE(v.is_inline());
+  ASSERT_EQ(v.capacity(), 4);
+}
+
+TEST(CreateSmallVector, size_and_init_list) {
+  small_vector<int, 4> a(3);
+  ASSERT_EQ(a.size(), 3);
+  ASSERT_EQ(a[2], 0);
+
+  small_vector<std::string, 2> b = {"a", "b", "c"};
+  ASSERT_FALSE(b.is_inline());
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_EQ(b.at(2), "c");
+  ASSERT_THROW(b.at(3), std::out_of_range);
+}
+
+TEST(CreateSmallVector, not_default_constructible) {
+  small_vector<std::unique_ptr<int>, 2> v;
+  v.insert_many_back(std::make_unique<int>(1), std::make_unique<int>(2),
+                     std::make_unique<int>(3));
+  ASSERT_EQ(v.size(), 3);
+  ASSERT_EQ(*v.back(), 3);
+}
+
+TEST(CopySmallVector, inline_and_heap) {
+  small_vector<std::string, 3> a = {"x", "y"};
+  small_vector<std::string, 3> b(a);
+  ASSERT_TRUE(b.is_inline());
+  ASSERT_EQ(b[1], "y");
+
+  a.push_back("z");
+  a.push_back("w");
+  b = a;
+  ASSERT_FALSE(b.is_inline());
+  ASSERT_EQ(b.size(), 4);
+  ASSERT_EQ(b[3], "w");
+  ASSERT_EQ(a[3], "w");
+}
+
+TEST(MoveSmallVector, inline_and_heap) {
+  small_vector<std::string, 2> a = {"x"};
+  small_vector<std::string, 2> b(std::move(a));
+  ASSERT_EQ(b[0], "x");
+  ASSERT_TRUE(a.empty());
+
+  small_vector<std::string, 2> c = {"1", "2", "3"};
+  const std::string *data = c.data();
+  b = std::move(c);
+  ASSERT_EQ(b.data(), data);
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_TRUE(c.empty());
+  ASSERT_TRUE(c.is_inline());
+}
+
+TEST(small_vector_push_back, spills_to_heap) {
+  small_vector<int, 4> v;
+  std::vector<int> ref;
+  for (int i = 0; i < 4; ++i) v.push_back(i);
+  ASSERT_TRUE(v.is_inline());
+  for (int i = 4; i < 100; ++i) v.push_back(i);
+  ASSERT_FALSE(v.is_inline());
+  for (int i = 0; i < 100; ++i) ASSERT_EQ(v[i], i);
+
+  v.push_back(v[0]);
+  ASSERT_EQ(v.back(), 0);
+  v.pop_back();
+  ASSERT_EQ(v.back(), 99);
+}
+
+TEST(small_vector_shrink, back_to_inline) {
+  small_vector<int, 4> v = {1, 2, 3, 4, 5, 6};
+  v.pop_back();
+  v.pop_back();
+  v.pop_back();
+  v.shrink_to_fit();
+  ASSERT_TRUE(v.is_inline());
+  ASSERT_EQ(v.size(), 3);
+  ASSERT_EQ(v[2], 3);
+
+  v.reserve(10);
+  ASSERT_EQ(v.capacity(), 10);
+  v.clear();
+  ASSERT_TRUE(v.empty());
+}
+
+TEST(small_vector_insert, insert_erase) {
+  small_vector<int, 4> v = {1, 2, 4};
+  auto it = v.insert(v.begin() + 2, 3);
+  ASSERT_EQ(*it, 3);
+  v.insert(v.end(), 5);
+  v.insert(v.begin(), v[4]);
+  std::vector<int> expected = {5, 1, 2, 3, 4, 5};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < v.size(); ++i) ASSERT_EQ(v[i], expected[i]);
+
+  v.erase(v.begin());
+  v.erase(v.end() - 1);
+  ASSERT_EQ(v.size(), 4);
+  ASSERT_EQ(v.front(), 1);
+  ASSERT_EQ(v.back(), 4);
+}
+
+TEST(small_vector_insert_many, test1) {
+  small_vector<int, 8> v = {1, 5};
+  auto it = v.insert_many(v.begin() + 1, 2, 3, 4);
+  ASSERT_EQ(*it, 2);
+  for (int i = 0; i < 5; ++i) ASSERT_EQ(v[i], i + 1);
+  v.insert_many_back(6, 7, 8, 9);
+  ASSERT_FALSE(v.is_inline());
+  for (int i = 0; i < 9; ++i) ASSERT_EQ(v[i], i + 1);
+}
+
+TEST(small_vector_swap, test1) {
+  small_vector<int, 2> a = {1};
+  small_vector<int, 2> b = {2, 3, 4};
+  a.swap(b);
+  ASSERT_EQ(a.size(), 3);
+  ASSERT_EQ(b.size(), 1);
+  ASSERT_EQ(a[2], 4);
+  ASSERT_EQ(b[0], 1);
+
+  small_vector<int, 2> c = {5, 6, 7, 8};
+  a.swap(c);
+  ASSERT_EQ(a.size(), 4);
+  ASSERT_EQ(c[0], 2);
+}
@@ -2,9 +2,13 @@
 
 #include <iostream>
 #include <stack>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "s21_containers.h"
+#include "s21_containersplus.h"
 
 using s21::stack;
 
@@ -169,3 +173,58 @@ TEST(stack_insert_many_front, test1) {
   S2.pop();
   ASSERT_EQ(S1.top(), S2.top());
 }
+
+TEST(stack_insert_many_front, own_elements) {
+  stack<std::string> S1 = {"a"};
+  S1.insert_many_front(S1.top(), S1.top());
+  ASSERT_EQ(S1.size(), 3);
+  ASSERT_EQ(S1.top(), "a");
+
+  stack<std::string, s21::small_vector<std::string, 1>> S2 = {"b"};
+  S2.insert_many_front(S2.top(), "c", S2.top());
+  ASSERT_EQ(S2.size(), 4);
+  ASSERT_EQ(S2.top(), "b");
+  S2.pop();
+  ASSERT_EQ(S2.top(), "c");
+}
+
+TEST(stack_move, steals_storage) {
+  static_assert(std::is_nothrow_move_constructible<stack<int>>::value);
+  static_assert(std::is_nothrow_move_assignable<stack<int>>::value);
+  stack<std::string> S1 = {"a", "b"};
+  const std::string* top = &S1.top();
+  stack<std::string> S2(std::move(S1));
+  ASSERT_EQ(&S2.top(), top);
+  ASSERT_EQ(S2.size(), 2);
+  ASSERT_EQ(S1.size(), 0);
+}
+
+TEST(stack_emplace, test1) {
+  stack<std::string> S1;
+  S1.reserve(10);
+  S1.emplace(3, 'x');
+  S1.emplace("top");
+  ASSERT_EQ(S1.size(), 2);
+  ASSERT_EQ(S1.top(), "top");
+  S1.pop();
+  ASSERT_EQ(S1.top(), "xxx");
+}
+
+TEST(stack_container, small_vector_and_list) {
+  stack<int, s21::small_vector<int, 4>> S1 = {1, 2};
+  S1.reserve(8);
+  S1.insert_many_front(3, 4, 5);
+  S1.emplace(6);
+  ASSERT_EQ(S1.size(), 6);
+  ASSERT_EQ(S1.top(), 6);
+  auto S2 = std::move(S1);
+  ASSERT_EQ(S2.top(), 6);
+
+  stack<int, s21::list<int>> S3(s21::list<int>{7, 8});
+  S3.push(9);
+  ASSERT_EQ(S3.size(), 3);
+  S3.pop();
+  S3.pop();
+  ASSERT_EQ(S3.size(), 1);
+  ASSERT_FALSE(S3.empty());
+}
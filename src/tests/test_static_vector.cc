@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "s21_containersplus.h"
+
+using s21::static_vector;
+
+static_assert(std::is_trivially_copyable<static_vector<int, 8>>::value);
+static_assert(
+    !std::is_trivially_copyable<static_vector<std::string, 8>>::value);
+
+constexpr int ConstexprSum() {
+  static_vector<int, 8> v = {1, 2};
+  v.push_back(4);
+  v.insert(v.begin(), 8);
+  v.insert_many(v.begin() + 1, 16, 32);
+  v.erase(v.begin());
+  int sum = 0;
+  for (int x : v) sum += x;
+  return sum;
+}
+static_assert(ConstexprSum() == 55);
+
+TEST(CreateStaticVector, test1) {
+  static_vector<int, 4> a;
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.capacity(), 4);
+  ASSERT_EQ(a.max_size(), 4);
+
+  static_vector<int, 4> b(3);
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_EQ(b[1], 0);
+
+  static_vector<std::string, 4> c = {"a", "b"};
+  ASSERT_EQ(c.at(1), "b");
+  ASSERT_THROW(c.at(2), std::out_of_range);
+  ASSERT_THROW((static_vector<int, 2>{1, 2, 3}), std::length_error);
+  ASSERT_THROW((static_vector<int, 2>(3)), std::length_error);
+}
+
+TEST(CopyStaticVector, test1) {
+  static_vector<std::string, 4> a = {"x", "y", "z"};
+  static_vector<std::string, 4> b(a);
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_EQ(b[2], "z");
+
+  static_vector<std::string, 4> c = {"1"};
+  c = a;
+  ASSERT_EQ(c.size(), 3);
+  ASSERT_EQ(c[0], "x");
+  c = static_vector<std::string, 4>{"q"};
+  ASSERT_EQ(c.size(), 1);
+  ASSERT_EQ(c[0], "q");
+
+  static_vector<std::string, 4> d(std::move(a));
+  ASSERT_EQ(d[1], "y");
+}
+
+TEST(static_vector_overflow, throws_or_returns_failure) {
+  static_vector<int, 2> v;
+  v.push_back(1);
+  ASSERT_NE(v.try_push_back(2), nullptr);
+  ASSERT_EQ(v.try_push_back(3), nullptr);
+  ASSERT_EQ(v.try_emplace_back(3), nullptr);
+  ASSERT_THROW(v.push_back(3), std::length_error);
+  ASSERT_THROW(v.insert(v.begin(), 3), std::length_error);
+  ASSERT_THROW(v.insert_many_back(3), std::length_error);
+  ASSERT_THROW(v.reserve(3), std::length_error);
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(v.back(), 2);
+}
+
+TEST(static_vector_insert, insert_erase) {
+  static_vector<std::string, 8> v = {"b", "d"};
+  v.insert(v.begin(), "a");
+  v.insert(v.begin() + 2, "c");
+  v.insert(v.end(), v[0]);
+  v.insert_many(v.begin() + 4, std::string("e"), std::string("f"));
+  const char *expected[] = {"a", "b", "c", "d", "e", "f", "a"};
+  ASSERT_EQ(v.size(), 7);
+  for (size_t i = 0; i < v.size(); ++i) ASSERT_EQ(v[i], expected[i]);
+
+  v.erase(v.begin() + 1);
+  v.pop_back();
+  ASSERT_EQ(v.size(), 5);
+  ASSERT_EQ(v[1], "c");
+  v.clear();
+  ASSERT_TRUE(v.empty());
+}
+
+TEST(static_vector_swap, test1) {
+  static_vector<std::unique_ptr<int>, 4> a;
+  static_vector<std::unique_ptr<int>, 4> b;
+  a.try_emplace_back(std::make_unique<int>(1));
+  b.insert_many_back(std::make_unique<int>(2), std::make_unique<int>(3),
+                     std::make_unique<int>(4));
+  a.swap(b);
+  ASSERT_EQ(a.size(), 3);
+  ASSERT_EQ(b.size(), 1);
+  ASSERT_EQ(*a[2], 4);
+  ASSERT_EQ(*b[0], 1);
+  b.swap(a);
+  ASSERT_EQ(*b[0], 2);
+  ASSERT_EQ(*a.front(), 1);
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "s21_containersplus.h"
+#include "tests/test_util.h"
+
+using s21::unrolled_list;
+
+namespace {
+
+// Throws from its move constructor once the budget of moves is spent
+struct FragileMove {
+  static inline int moves_left = -1;
+
+  explicit FragileMove(int v) : value(v) {}
+  FragileMove(const FragileMove &) = default;
+  FragileMove(FragileMove &&other) : value(other.value) {
+    if (moves_left == 0) throw std::runtime_error("move");
+    if (moves_left > 0) --moves_left;
+  }
+  FragileMove &operator=(const FragileMove &) = default;
+  FragileMove &operator=(FragileMove &&) = default;
+  bool operator==(const FragileMove &other) const {
+    return value == other.value;
+  }
+
+  int value;
+};
+
+}  // namespace
+
+TEST(UnrolledList, create) {
+  unrolled_list<int> a;
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(a.begin(), a.end());
+
+  unrolled_list<int, 4> b(10);
+  ExpectEqual(b, std::list<int>(10));
+
+  unrolled_list<std::string, 4> c = {"a", "b", "c", "d", "e", "f"};
+  ExpectEqual(c, std::list<std::string>{"a", "b", "c", "d", "e", "f"});
+  ASSERT_EQ(c.front(), "a");
+  ASSERT_EQ(c.back(), "f");
+
+  unrolled_list<std::string, 4> d(c);
+  ExpectEqual(d, std::list<std::string>{"a", "b", "c", "d", "e", "f"});
+  unrolled_list<std::string, 4> e(std::move(c));
+  ASSERT_TRUE(c.empty());
+  ExpectEqual(e, std::list<std::string>{"a", "b", "c", "d", "e", "f"});
+  c = e;
+  e = std::move(d);
+  ExpectEqual(c, std::list<std::string>{"a", "b", "c", "d", "e", "f"});
+  ExpectEqual(e, std::list<std::string>{"a", "b", "c", "d", "e", "f"});
+}
+
+TEST(UnrolledList, push_pop) {
+  unrolled_list<int, 4> l;
+  ASSERT_THROW(l.pop_back(), std::logic_error);
+  ASSERT_THROW(l.pop_front(), std::logic_error);
+  std::list<int> expected;
+  for (int i = 0; i < 20; ++i) {
+    l.push_back(i);
+    l.push_front(-i);
+    expected.push_back(i);
+    expected.push_front(-i);
+  }
+  ExpectEqual(l, expected);
+  for (int i = 0; i < 15; ++i) {
+    l.pop_back();
+    l.pop_front();
+    expected.pop_back();
+    expected.pop_front();
+  }
+  ExpectEqual(l, expected);
+}
+
+// Random inserts and erases in small blocks, so that they split and
+// merge all the time
+TEST(UnrolledList, random_insert_erase) {
+  unrolled_list<std::string, 4> l;
+  std::list<std::string> expected;
+  std::mt19937 gen(5);
+  for (int i = 0; i < 4000; ++i) {
+    size_t at = expected.empty() ? 0 : gen() % (expected.size() + 1);
+    auto it = std::next(l.begin(), at);
+    auto expected_it = std::next(expected.begin(), at);
+    if (gen() % 5 < 3 || at == expected.size()) {
+      std::string value = std::to_string(i);
+      ASSERT_EQ(*l.insert(it, value), value);
+      expected.insert(expected_it, value);
+    } else {
+      auto next = l.erase(it);
+      expected_it = expected.erase(expected_it);
+      if (expected_it == expected.end())
+        ASSERT_EQ(next, l.end());
+      else
+        ASSERT_EQ(*next, *expected_it);
+    }
+  }
+  ExpectEqual(l, expected);
+  while (!expected.empty()) {
+    l.erase(std::next(l.begin(), expected.size() / 2));
+    expected.erase(std::next(expected.begin(), expected.size() / 2));
+  }
+  ASSERT_TRUE(l.empty());
+  ASSERT_EQ(l.begin(), l.end());
+}
+
+TEST(UnrolledList, splice) {
+  unrolled_list<int, 4> a = {1, 2, 3, 4, 5, 6};
+  unrolled_list<int, 4> b = {7, 8, 9};
+  a.splice(std::next(a.begin(), 2), b);
+  ASSERT_TRUE(b.empty());
+  ExpectEqual(a, std::list<int>{1, 2, 7, 8, 9, 3, 4, 5, 6});
+
+  unrolled_list<int, 4> c = {0};
+  a.splice(a.begin(), c);
+  b = {10, 11};
+  a.splice(a.end(), b);
+  ExpectEqual(a, std::list<int>{0, 1, 2, 7, 8, 9, 3, 4, 5, 6, 10, 11});
+  a.splice(a.end(), b);
+  ASSERT_EQ(a.size(), 12);
+}
+
+TEST(UnrolledList, sort_merge_unique_reverse) {
+  unrolled_list<int, 4> a = {5, 3, 9, 1, 7, 3, 3};
+  a.sort();
+  ExpectEqual(a, std::list<int>{1, 3, 3, 3, 5, 7, 9});
+  a.unique();
+  ExpectEqual(a, std::list<int>{1, 3, 5, 7, 9});
+
+  unrolled_list<int, 4> b = {2, 4, 10};
+  a.merge(b);
+  ASSERT_TRUE(b.empty());
+  ExpectEqual(a, std::list<int>{1, 2, 3, 4, 5, 7, 9, 10});
+
+  a.reverse();
+  ExpectEqual(a, std::list<int>{10, 9, 7, 5, 4, 3, 2, 1});
+  b.reverse();
+  ASSERT_TRUE(b.empty());
+  ASSERT_THROW(b.unique(), std::logic_error);
+}
+
+TEST(UnrolledList, insert_many) {
+  unrolled_list<std::string, 4> l = {"a", "e"};
+  l.insert_many(std::next(l.begin()), "b", "c", "d");
+  l.insert_many_back("f", "g");
+  l.insert_many_front("1", "0");
+  ExpectEqual(l, std::list<std::string>{"0", "1", "a", "b", "c", "d", "e",
+                                         "f", "g"});
+  l.emplace(l.end(), 2, 'h');
+  ASSERT_EQ(l.back(), "hh");
+}
+
+TEST(UnrolledList, swap) {
+  unrolled_list<int> a = {1, 2, 3};
+  unrolled_list<int> b;
+  a.swap(b);
+  ASSERT_TRUE(a.empty());
+  ExpectEqual(b, std::list<int>{1, 2, 3});
+  a.push_back(4);
+  a.swap(b);
+  ExpectEqual(a, std::list<int>{1, 2, 3});
+  ExpectEqual(b, std::list<int>{4});
+}
+
+TEST(UnrolledList, throwing_move) {
+  unrolled_list<FragileMove, 4> l;
+  std::list<FragileMove> expected;
+  for (int i = 0; i < 8; ++i) {
+    l.emplace(l.end(), i);
+    expected.emplace_back(i);
+  }
+  // into a new block at the end
+  FragileMove::moves_left = 0;
+  ASSERT_THROW(l.emplace(l.end(), 8), std::runtime_error);
+  FragileMove::moves_left = -1;
+  ExpectEqual(l, expected);
+  // into a full block, which is split first
+  FragileMove::moves_left = 1;
+  ASSERT_THROW(l.emplace(std::next(l.begin()), 9), std::runtime_error);
+  FragileMove::moves_left = -1;
+  ExpectEqual(l, expected);
+  l.emplace(std::next(l.begin()), 9);
+  expected.emplace(std::next(expected.begin()), 9);
+  ExpectEqual(l, expected);
+}
@@ -0,0 +1,20 @@
+#ifndef S21_CONTAINERS_TESTS_TEST_UTIL_H_  // NOLINT
+#define S21_CONTAINERS_TESTS_TEST_UTIL_H_  // NOLINT
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+
+// Compares a container with the expected one of the standard library
+// forwards and backwards
+template <typename Container, typename Expected>
+void ExpectEqual(const Container &c, const Expected &expected) {
+  ASSERT_EQ(c.size(), expected.size());
+  ASSERT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+  ASSERT_TRUE(std::equal(std::make_reverse_iterator(c.end()),
+                         std::make_reverse_iterator(c.begin()),
+                         expected.rbegin()));
+}
+
+#endif  // S21_CONTAINERS_TESTS_TEST_UTIL_H_  // NOLINT
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "s21_containers.h"
@@ -303,3 +307,167 @@ TEST(vector_insert_many_back, test1) {
   }
   ASSERT_EQ(V1.size(), V2.size());
 }
+
+TEST(vector_insert_many, own_elements) {
+  // with a reallocation
+  vector<std::string> V1 = {"a", "b"};
+  V1.shrink_to_fit();
+  V1.insert_many_back(V1[0], V1[1]);
+  ASSERT_EQ(std::vector<std::string>(V1.begin(), V1.end()),
+            std::vector<std::string>({"a", "b", "a", "b"}));
+  // without one: the elements shift under the arguments
+  vector<int> V2 = {1, 2, 3, 4};
+  V2.reserve(10);
+  V2.insert_many(V2.begin(), V2[3], V2[0]);
+  ASSERT_EQ(std::vector<int>(V2.begin(), V2.end()),
+            std::vector<int>({4, 1, 1, 2, 3, 4}));
+}
+
+TEST(vector_growth, batch_appends_grow_geometrically) {
+  vector<int> V1;
+  size_t reallocations = 0;
+  for (int i = 0; i < 1000; i++) {
+    size_t cap = V1.capacity();
+    V1.insert_many_back(i, i, i);
+    if (V1.capacity() != cap) reallocations++;
+  }
+  ASSERT_EQ(V1.size(), 3000);
+  ASSERT_LT(reallocations, 15);
+  ASSERT_EQ(V1.at(2999), 999);
+}
+
+TEST(vector_growth, policies) {
+  vector<int, s21::growth_1_5x> V1 = {1, 2, 3, 4};
+  V1.push_back(5);
+  ASSERT_EQ(V1.capacity(), 7);
+
+  struct GrowBy10 {
+    size_t operator()(size_t capacity, size_t required) const {
+      return std::max(capacity + 10, required);
+    }
+  };
+  vector<int, GrowBy10> V2;
+  V2.push_back(1);
+  ASSERT_EQ(V2.capacity(), 10);
+  V2.insert_many_back(2, 3, 4, 5, 6, 7, 8, 9, 10, 11);
+  ASSERT_EQ(V2.capacity(), 20);
+  ASSERT_EQ(V2.at(10), 11);
+}
+
+TEST(vector_reserve_exact, test1) {
+  vector<int> V1 = {1, 2};
+  V1.reserve_exact(1000);
+  ASSERT_EQ(V1.capacity(), 1000);
+  for (int i = 2; i < 1000; i++) V1.push_back(i);
+  ASSERT_EQ(V1.capacity(), 1000);
+  V1.reserve_exact(10);
+  ASSERT_EQ(V1.capacity(), 1000);
+}
+
+TEST(vector_insert_range, test1) {
+  vector<int> V1 = {1, 2, 9};
+  std::vector<int> V2 = {1, 2, 9};
+  std::vector<int> src = {3, 4, 5, 6, 7, 8};
+  auto it = V1.insert(V1.begin() + 2, src.begin(), src.end());
+  V2.insert(V2.begin() + 2, src.begin(), src.end());
+  ASSERT_EQ(*it, 3);
+  ASSERT_EQ(V1.size(), V2.size());
+  for (int i = 0; i < (int)V1.size(); i++) ASSERT_EQ(V1.at(i), V2.at(i));
+
+  V1.insert(V1.end(), 3, 10);
+  V2.insert(V2.end(), 3, 10);
+  V1.insert(V1.begin(), 2, V1[1]);
+  V2.insert(V2.begin(), 2, V2[1]);
+  ASSERT_EQ(V1.size(), V2.size());
+  for (int i = 0; i < (int)V1.size(); i++) ASSERT_EQ(V1.at(i), V2.at(i));
+}
+
+TEST(vector_insert_range, input_iterators) {
+  std::istringstream in("4 5 6");
+  vector<int> V1 = {1, 7};
+  V1.insert(V1.begin() + 1, std::istream_iterator<int>(in),
+            std::istream_iterator<int>());
+  ASSERT_EQ(V1.size(), 5);
+  for (int i = 0; i < 3; i++) ASSERT_EQ(V1.at(i + 1), i + 4);
+}
+
+TEST(vector_erase_range, test1) {
+  vector<int> V1 = {0, 1, 2, 3, 4, 5, 6, 7};
+  std::vector<int> V2 = {0, 1, 2, 3, 4, 5, 6, 7};
+  auto it = V1.erase(V1.begin() + 2, V1.begin() + 5);
+  V2.erase(V2.begin() + 2, V2.begin() + 5);
+  ASSERT_EQ(*it, 5);
+  ASSERT_EQ(V1.size(), V2.size());
+  for (int i = 0; i < (int)V1.size(); i++) ASSERT_EQ(V1.at(i), V2.at(i));
+  it = V1.erase(V1.begin(), V1.end());
+  ASSERT_EQ(it, V1.end());
+  ASSERT_TRUE(V1.empty());
+}
+
+TEST(vector_resize, test1) {
+  vector<std::string> V1 = {"a", "b"};
+  V1.resize(4);
+  ASSERT_EQ(V1.size(), 4);
+  ASSERT_EQ(V1.at(3), "");
+  V1.resize(1);
+  ASSERT_EQ(V1.size(), 1);
+  V1.resize(3, "z");
+  ASSERT_EQ(V1.at(0), "a");
+  ASSERT_EQ(V1.at(1), "z");
+  ASSERT_EQ(V1.at(2), "z");
+}
+
+TEST(vector_assign, test1) {
+  vector<int> V1 = {1, 2, 3};
+  V1.assign(5, 7);
+  ASSERT_EQ(V1.size(), 5);
+  ASSERT_EQ(V1.at(4), 7);
+
+  std::vector<int> src = {9, 8};
+  V1.assign(src.begin(), src.end());
+  ASSERT_EQ(V1.size(), 2);
+  ASSERT_EQ(V1.at(1), 8);
+
+  V1.assign({4, 5, 6, 7, 8, 9, 10});
+  ASSERT_EQ(V1.size(), 7);
+  ASSERT_EQ(V1.at(6), 10);
+}
+
+TEST(vector_mapped, pointers_stay_valid) {
+  vector<int> V1(s21::mapped_storage{size_t(1) << 28});
+  ASSERT_TRUE(V1.is_mapped());
+  ASSERT_EQ(V1.max_size(), size_t(1) << 28);
+  V1.push_back(0);
+  int *first = &V1[0];
+  for (int i = 1; i < 1000000; i++) V1.push_back(i);
+  ASSERT_EQ(&V1[0], first);
+  ASSERT_EQ(V1.at(999999), 999999);
+
+  V1.insert(V1.begin(), 5, -1);
+  ASSERT_EQ(&V1[0], first);
+  ASSERT_EQ(V1.at(5), 0);
+  ASSERT_EQ(V1.size(), 1000005);
+
+  vector<int> V2(V1);
+  ASSERT_FALSE(V2.is_mapped());
+  ASSERT_EQ(V2.at(1000004), 999999);
+}
+
+TEST(vector_mapped, limit_and_move) {
+  vector<std::string> V1(s21::mapped_storage{3, false});
+  V1.insert_many_back("a", "b", "c");
+  ASSERT_THROW(V1.push_back("d"), std::length_error);
+  ASSERT_EQ(V1.size(), 3);
+  ASSERT_EQ(V1.capacity(), 3);
+  V1.shrink_to_fit();
+  ASSERT_EQ(V1.capacity(), 3);
+
+  vector<std::string> V2 = {"x"};
+  V2 = std::move(V1);
+  ASSERT_TRUE(V2.is_mapped());
+  ASSERT_EQ(V2.at(2), "c");
+  V1.swap(V2);
+  ASSERT_TRUE(V1.is_mapped());
+  ASSERT_FALSE(V2.is_mapped());
+  ASSERT_EQ(V1.at(0), "a");
+}
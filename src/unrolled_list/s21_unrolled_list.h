@@ -0,0 +1,528 @@
+#ifndef S21_CONTAINERS_UNROLLED_LIST_UNROLLED_LIST_H_  // NOLINT
+#define S21_CONTAINERS_UNROLLED_LIST_UNROLLED_LIST_H_  // NOLINT
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// The links of a block of unrolled_list. The list holds one more of
+// them as the sentinel: it has no elements and closes the ring.
+struct UnrolledListLinks {
+  UnrolledListLinks *prev;
+  UnrolledListLinks *next;
+  size_t count;
+};
+
+// A list with the interface of s21::list whose nodes are blocks of up
+// to BlockSize elements (512 bytes of them by default, but at least 16)
+// in a ring of doubly linked blocks. For small elements that saves the
+// two pointers and the allocation per element, and iteration walks
+// contiguous memory, so it runs close to the speed of a vector.
+//
+// Inserting into a full block splits it in half, and a block that gets
+// less than a quarter full is merged with a neighbour, so the blocks
+// stay at least a quarter full (apart from the neighbours of a merge
+// that didn't fit). Insertion and erasure take O(BlockSize) and
+// invalidate the iterators into the affected blocks; splice() is O(1)
+// at a block boundary and O(BlockSize) elsewhere (the block is split).
+template <typename T,
+          size_t BlockSize = std::max<size_t>(16, 512 / sizeof(T))>
+class unrolled_list {
+  static_assert(BlockSize >= 4, "the blocks are too small");
+
+  struct Block : UnrolledListLinks {
+    T *Data() noexcept { return std::launder(reinterpret_cast<T *>(storage_)); }
+
+    alignas(T) unsigned char storage_[sizeof(T) * BlockSize];
+  };
+
+ public:
+  // member types
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  template <bool Const>
+  class UnrolledListIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    UnrolledListIterator() = default;
+    // iterator converts to const_iterator
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    UnrolledListIterator(const UnrolledListIterator<false> &other)  // NOLINT
+        : block_(other.block_), index_(other.index_) {}
+
+    reference operator*() const {
+      return static_cast<Block *>(block_)->Data()[index_];
+    }
+    pointer operator->() const { return &**this; }
+
+    UnrolledListIterator &operator++() {
+      if (++index_ == block_->count) {
+        block_ = block_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+    UnrolledListIterator operator++(int) {
+      UnrolledListIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    UnrolledListIterator &operator--() {
+      if (index_ == 0) {
+        block_ = block_->prev;
+        index_ = block_->count;
+      }
+      --index_;
+      return *this;
+    }
+    UnrolledListIterator operator--(int) {
+      UnrolledListIterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const UnrolledListIterator &rhs) const {
+      return block_ == rhs.block_ && index_ == rhs.index_;
+    }
+    bool operator!=(const UnrolledListIterator &rhs) const {
+      return !(*this == rhs);
+    }
+
+   private:
+    UnrolledListIterator(UnrolledListLinks *block, size_t index)
+        : block_(block), index_(index) {}
+
+    // the end is the sentinel with index 0
+    UnrolledListLinks *block_ = nullptr;
+    size_t index_ = 0;
+    friend class unrolled_list;
+    template <bool>
+    friend class UnrolledListIterator;
+  };
+
+  using iterator = UnrolledListIterator<false>;
+  using const_iterator = UnrolledListIterator<true>;
+
+  // constructors
+  unrolled_list() noexcept { Reset(); }
+  explicit unrolled_list(size_type n);
+  unrolled_list(std::initializer_list<value_type> const &items);
+  unrolled_list(const unrolled_list &l);
+  unrolled_list(unrolled_list &&l) noexcept;
+  ~unrolled_list() { clear(); }
+  unrolled_list &operator=(const unrolled_list &l);
+  unrolled_list &operator=(unrolled_list &&l) noexcept;
+
+  // element access
+  reference front() { return *begin(); }
+  const_reference front() const { return *begin(); }
+  reference back() { return *--end(); }
+  const_reference back() const { return *--end(); }
+
+  // iterators
+  iterator begin() noexcept { return iterator(head_.next, 0); }
+  const_iterator begin() const noexcept {
+    return const_iterator(head_.next, 0);
+  }
+  iterator end() noexcept { return iterator(&head_, 0); }
+  const_iterator end() const noexcept {
+    return const_iterator(const_cast<UnrolledListLinks *>(&head_), 0);
+  }
+
+  // capacity
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_t>::max() / 2 / sizeof(T);
+  }
+
+  // modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const_reference value);
+  // Returns the iterator to the element that followed the erased one
+  iterator erase(const_iterator pos);
+  void push_back(const_reference value) { insert(end(), value); }
+  void pop_back();
+  void push_front(const_reference value) { insert(begin(), value); }
+  void pop_front();
+  void swap(unrolled_list &other) noexcept;
+  void reverse() noexcept;
+  void merge(unrolled_list &other);
+  void unique();
+  void sort();
+  // Moves the elements of other before pos
+  void splice(const_iterator pos, unrolled_list &other);
+
+  // Bonus
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  void insert_many(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+  template <typename... Args>
+  void insert_many_front(Args &&...args);
+
+ private:
+  void Reset() noexcept {
+    head_.prev = head_.next = &head_;
+    head_.count = 0;
+  }
+  static Block *AsBlock(UnrolledListLinks *links) noexcept {
+    return static_cast<Block *>(links);
+  }
+  // An empty block linked after pos
+  static Block *NewBlockAfter(UnrolledListLinks *pos);
+  static void FreeBlock(Block *block) noexcept;
+  // Moves the elements from index from on to a new block after block
+  static Block *Split(Block *block, size_t from);
+  // Moves the elements of from to the end of to and frees from
+  static void Absorb(Block *to, Block *from) noexcept;
+
+  // Moves all the elements out, leaving the list empty
+  std::vector<value_type> Take();
+  // Appends the elements in full blocks
+  void Append(std::vector<value_type> &&items);
+
+  UnrolledListLinks head_;
+  size_type size_ = 0;
+};
+
+// Constructors
+template <typename T, size_t BlockSize>
+unrolled_list<T, BlockSize>::unrolled_list(size_type n) : unrolled_list() {
+  if (n >= max_size()) {
+    throw std::out_of_range("Incorrect size");
+  }
+  for (size_type i = 0; i < n; ++i) emplace(end());
+}
+
+template <typename T, size_t BlockSize>
+unrolled_list<T, BlockSize>::unrolled_list(
+    std::initializer_list<value_type> const &items)
+    : unrolled_list() {
+  for (const value_type &item : items) push_back(item);
+}
+
+template <typename T, size_t BlockSize>
+unrolled_list<T, BlockSize>::unrolled_list(const unrolled_list &l)
+    : unrolled_list() {
+  for (const value_type &item : l) push_back(item);
+}
+
+template <typename T, size_t BlockSize>
+unrolled_list<T, BlockSize>::unrolled_list(unrolled_list &&l) noexcept
+    : unrolled_list() {
+  swap(l);
+}
+
+template <typename T, size_t BlockSize>
+unrolled_list<T, BlockSize> &unrolled_list<T, BlockSize>::operator=(
+    const unrolled_list &l) {
+  if (this != &l) {
+    unrolled_list tmp(l);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T, size_t BlockSize>
+unrolled_list<T, BlockSize> &unrolled_list<T, BlockSize>::operator=(
+    unrolled_list &&l) noexcept {
+  if (this != &l) {
+    clear();
+    swap(l);
+  }
+  return *this;
+}
+
+// Modifiers
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::clear() noexcept {
+  while (head_.next != &head_) {
+    Block *block = AsBlock(head_.next);
+    std::destroy(block->Data(), block->Data() + block->count);
+    FreeBlock(block);
+  }
+  size_ = 0;
+}
+
+template <typename T, size_t BlockSize>
+typename unrolled_list<T, BlockSize>::iterator
+unrolled_list<T, BlockSize>::insert(const_iterator pos,
+                                    const_reference value) {
+  return emplace(pos, value);
+}
+
+// The value is made first, so args may refer to the elements and a
+// throwing constructor leaves the list as it was. If moving an element
+// throws, the list stays valid but the moved elements are unspecified.
+template <typename T, size_t BlockSize>
+template <typename... Args>
+typename unrolled_list<T, BlockSize>::iterator
+unrolled_list<T, BlockSize>::emplace(const_iterator pos, Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  UnrolledListLinks *links = pos.block_;
+  size_t i = pos.index_;
+  if (i == 0 && links->prev != &head_ && links->prev->count < BlockSize) {
+    // the end of the previous block is the same place and it has room
+    links = links->prev;
+    i = links->count;
+  } else if (links == &head_ || (i == 0 && links->count == BlockSize)) {
+    links = NewBlockAfter(links->prev);
+    i = 0;
+  } else if (links->count == BlockSize) {
+    Block *right = Split(AsBlock(links), BlockSize / 2);
+    if (i > BlockSize / 2) {
+      links = right;
+      i -= BlockSize / 2;
+    }
+  }
+
+  T *data = AsBlock(links)->Data();
+  size_t n = links->count;
+  try {
+    if (i == n) {
+      ::new (static_cast<void *>(data + n)) T(std::move(value));
+    } else {
+      ::new (static_cast<void *>(data + n)) T(std::move(data[n - 1]));
+      std::move_backward(data + i, data + n - 1, data + n);
+      data[i] = std::move(value);
+    }
+  } catch (...) {
+    // only a new block is empty, and the list has no empty blocks
+    if (n == 0) FreeBlock(AsBlock(links));
+    throw;
+  }
+  ++links->count;
+  ++size_;
+  return iterator(links, i);
+}
+
+template <typename T, size_t BlockSize>
+typename unrolled_list<T, BlockSize>::iterator
+unrolled_list<T, BlockSize>::erase(const_iterator pos) {
+  Block *block = AsBlock(pos.block_);
+  size_t i = pos.index_;
+  T *data = block->Data();
+  std::move(data + i + 1, data + block->count, data + i);
+  std::destroy_at(data + --block->count);
+  --size_;
+
+  UnrolledListLinks *next = block->next;
+  UnrolledListLinks *prev = block->prev;
+  if (block->count == 0) {
+    FreeBlock(block);
+    return iterator(next, 0);
+  }
+  if (block->count < BlockSize / 4) {
+    if (next != &head_ && block->count + next->count <= BlockSize) {
+      Absorb(block, AsBlock(next));
+    } else if (prev != &head_ && prev->count + block->count <= BlockSize) {
+      i += prev->count;
+      Absorb(AsBlock(prev), block);
+      block = AsBlock(prev);
+    }
+  }
+  if (i == block->count) return iterator(block->next, 0);
+  return iterator(block, i);
+}
+
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::pop_back() {
+  if (empty()) {
+    throw std::logic_error("List size is 0");
+  }
+  erase(--end());
+}
+
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::pop_front() {
+  if (empty()) {
+    throw std::logic_error("List size is 0");
+  }
+  erase(begin());
+}
+
+// The blocks link to the sentinel, so the links around it are fixed up
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::swap(unrolled_list &other) noexcept {
+  auto relink = [](UnrolledListLinks *head, UnrolledListLinks *old_head) {
+    if (head->next == old_head) {
+      head->prev = head->next = head;
+    } else {
+      head->next->prev = head;
+      head->prev->next = head;
+    }
+  };
+  std::swap(head_, other.head_);
+  relink(&head_, &other.head_);
+  relink(&other.head_, &head_);
+  std::swap(size_, other.size_);
+}
+
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::reverse() noexcept {
+  UnrolledListLinks *links = &head_;
+  do {
+    std::swap(links->prev, links->next);
+    if (links != &head_)
+      std::reverse(AsBlock(links)->Data(),
+                   AsBlock(links)->Data() + links->count);
+    links = links->prev;
+  } while (links != &head_);
+}
+
+// Both lists must be sorted; merges them in O(n)
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::merge(unrolled_list &other) {
+  if (this == &other) return;
+  std::vector<value_type> items = Take();
+  size_t middle = items.size();
+  for (value_type &item : other) items.push_back(std::move(item));
+  other.clear();
+  std::inplace_merge(items.begin(), items.begin() + middle, items.end());
+  Append(std::move(items));
+}
+
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::unique() {
+  if (empty()) {
+    throw std::logic_error("List size is 0");
+  }
+  std::vector<value_type> items = Take();
+  items.erase(std::unique(items.begin(), items.end()), items.end());
+  Append(std::move(items));
+}
+
+// Sorts the elements in a vector (stably, like list::sort) and packs
+// them into full blocks
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::sort() {
+  std::vector<value_type> items = Take();
+  std::stable_sort(items.begin(), items.end());
+  Append(std::move(items));
+}
+
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::splice(const_iterator pos,
+                                         unrolled_list &other) {
+  if (other.empty() || this == &other) return;
+  UnrolledListLinks *before = pos.block_;
+  if (pos.index_ != 0) before = Split(AsBlock(before), pos.index_);
+
+  UnrolledListLinks *first = other.head_.next;
+  UnrolledListLinks *last = other.head_.prev;
+  first->prev = before->prev;
+  before->prev->next = first;
+  last->next = before;
+  before->prev = last;
+  size_ += other.size_;
+  other.Reset();
+  other.size_ = 0;
+}
+
+// Bonus
+template <typename T, size_t BlockSize>
+template <typename... Args>
+void unrolled_list<T, BlockSize>::insert_many(const_iterator pos,
+                                              Args &&...args) {
+  ((pos = ++emplace(pos, std::forward<Args>(args))), ...);
+}
+
+template <typename T, size_t BlockSize>
+template <typename... Args>
+void unrolled_list<T, BlockSize>::insert_many_back(Args &&...args) {
+  (emplace(end(), std::forward<Args>(args)), ...);
+}
+
+template <typename T, size_t BlockSize>
+template <typename... Args>
+void unrolled_list<T, BlockSize>::insert_many_front(Args &&...args) {
+  (emplace(begin(), std::forward<Args>(args)), ...);
+}
+
+// Blocks
+template <typename T, size_t BlockSize>
+typename unrolled_list<T, BlockSize>::Block *
+unrolled_list<T, BlockSize>::NewBlockAfter(UnrolledListLinks *pos) {
+  Block *block = new Block;
+  block->count = 0;
+  block->prev = pos;
+  block->next = pos->next;
+  pos->next->prev = block;
+  pos->next = block;
+  return block;
+}
+
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::FreeBlock(Block *block) noexcept {
+  block->prev->next = block->next;
+  block->next->prev = block->prev;
+  delete block;
+}
+
+template <typename T, size_t BlockSize>
+typename unrolled_list<T, BlockSize>::Block *
+unrolled_list<T, BlockSize>::Split(Block *block, size_t from) {
+  Block *right = NewBlockAfter(block);
+  T *data = block->Data();
+  try {
+    std::uninitialized_move(data + from, data + block->count, right->Data());
+  } catch (...) {
+    FreeBlock(right);
+    throw;
+  }
+  std::destroy(data + from, data + block->count);
+  right->count = block->count - from;
+  block->count = from;
+  return right;
+}
+
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::Absorb(Block *to, Block *from) noexcept {
+  T *data = from->Data();
+  std::uninitialized_move(data, data + from->count, to->Data() + to->count);
+  std::destroy(data, data + from->count);
+  to->count += from->count;
+  FreeBlock(from);
+}
+
+template <typename T, size_t BlockSize>
+std::vector<T> unrolled_list<T, BlockSize>::Take() {
+  std::vector<value_type> items;
+  items.reserve(size_);
+  for (value_type &item : *this) items.push_back(std::move(item));
+  clear();
+  return items;
+}
+
+template <typename T, size_t BlockSize>
+void unrolled_list<T, BlockSize>::Append(std::vector<value_type> &&items) {
+  for (value_type &item : items) emplace(end(), std::move(item));
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_UNROLLED_LIST_UNROLLED_LIST_H_  // NOLINT
@@ -0,0 +1,86 @@
+// Reservation of address space for vector's mapped storage mode.
+// The whole range is reserved at once without any memory behind it and
+// then committed page by page as the vector grows, so its elements
+// never move.
+
+#ifndef S21_CONTAINERS_VECTOR_MAPPED_MEMORY_H_  // NOLINT
+#define S21_CONTAINERS_VECTOR_MAPPED_MEMORY_H_  // NOLINT
+
+#include <cstddef>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define S21_HAS_MMAP 1
+#endif
+
+namespace s21 {
+
+// The parameters of vector's mapped storage mode: room for max_size
+// elements is reserved up front. huge_pages asks the kernel to back
+// the range with transparent huge pages (where it supports them).
+struct mapped_storage {
+  size_t max_size;
+  bool huge_pages = true;
+};
+
+class MappedMemory {
+ public:
+  // Reserves bytes of address space. Returns nullptr if mapping isn't
+  // supported on the platform.
+  static void *Reserve(size_t bytes, bool huge_pages) {
+#ifdef S21_HAS_MMAP
+    void *p = mmap(nullptr, RoundUp(bytes), PROT_NONE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+    if (huge_pages) madvise(p, RoundUp(bytes), MADV_HUGEPAGE);
+#endif
+    return p;
+#else
+    (void)bytes;
+    (void)huge_pages;
+    return nullptr;
+#endif
+  }
+
+  // Makes the first new_bytes of the range usable (the first old_bytes
+  // already are). The new pages read as zeros.
+  static void Commit(void *base, size_t old_bytes, size_t new_bytes) {
+#ifdef S21_HAS_MMAP
+    size_t from = RoundUp(old_bytes);
+    size_t to = RoundUp(new_bytes);
+    if (to > from && mprotect(static_cast<char *>(base) + from, to - from,
+                              PROT_READ | PROT_WRITE) != 0)
+      throw std::bad_alloc();
+#else
+    (void)base;
+    (void)old_bytes;
+    (void)new_bytes;
+#endif
+  }
+
+  static void Release(void *base, size_t bytes) noexcept {
+#ifdef S21_HAS_MMAP
+    munmap(base, RoundUp(bytes));
+#else
+    (void)base;
+    (void)bytes;
+#endif
+  }
+
+ private:
+  static size_t RoundUp(size_t bytes) noexcept {
+#ifdef S21_HAS_MMAP
+    static const size_t page = sysconf(_SC_PAGESIZE);
+    return (bytes + page - 1) / page * page;
+#else
+    return bytes;
+#endif
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_VECTOR_MAPPED_MEMORY_H_  // NOLINT
@@ -1,19 +1,47 @@
 #ifndef S21_CONTAINERS_VECTOR_VECTOR_H_  // NOLINT
 #define S21_CONTAINERS_VECTOR_VECTOR_H_  // NOLINT
 
+#include <algorithm>
 #include <exception>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "vector/mapped_memory.h"
 
 #define MAX_SIZE 9223372036854775807
 
 namespace s21 {
-template <typename T>
+
+// Growth policies of vector. A policy is a default constructible
+// functor that takes the current capacity and the number of elements
+// that must fit and returns the new capacity (not less than required).
+// Any functor of this form can be passed as a custom policy.
+struct growth_2x {
+  size_t operator()(size_t capacity, size_t required) const noexcept {
+    return std::max(capacity * 2 + 1, required);
+  }
+};
+
+// Wastes less memory than growth_2x at the cost of more reallocations.
+struct growth_1_5x {
+  size_t operator()(size_t capacity, size_t required) const noexcept {
+    return std::max(capacity + capacity / 2 + 1, required);
+  }
+};
+
+template <typename T, typename Growth = growth_2x>
 class vector {
  private:
   size_t size_;
   size_t capacity_;
   T *arr_;
+  // number of elements reserved in the mapped storage mode,
+  // 0 for the ordinary heap storage
+  size_t mapped_size_ = 0;
 
  public:
   // types
@@ -44,8 +72,19 @@ class vector {
   vector(const vector &v);
   vector(vector &&v) noexcept;
 
+  // An empty vector in the mapped storage mode: address space for
+  // storage.max_size elements is reserved up front and memory is
+  // committed as the vector grows, so growing never moves the elements
+  // and pointers to them stay valid. The vector can't grow beyond
+  // storage.max_size. Where mmap isn't available it is an ordinary
+  // vector. Copies of the vector use the ordinary storage.
+  explicit vector(mapped_storage storage);
+
   ~vector() {
-    delete[] arr_;
+    if (is_mapped())
+      ReleaseMapped();
+    else
+      delete[] arr_;
     size_ = 0;
     capacity_ = 0;
   }
@@ -81,24 +120,40 @@ class vector {
   // capacity
   bool empty() const noexcept { return begin() == end() ? 1 : 0; }
   size_type size() const noexcept { return size_; }
-  size_type max_size() const noexcept { return MAX_SIZE / sizeof(T); }
+  size_type max_size() const noexcept {
+    return is_mapped() ? mapped_size_ : MAX_SIZE / sizeof(T);
+  }
   void reserve(size_type size);
+  void reserve_exact(size_type size);
   size_type capacity() const noexcept { return capacity_; }
   void shrink_to_fit();
+  bool is_mapped() const noexcept { return mapped_size_ != 0; }
 
   // modifiers
   void clear() { size_ = 0; }
   iterator insert(iterator pos, const_reference value);
+  iterator insert(const_iterator pos, size_type n, const_reference value);
+  template <typename InputIt, typename = std::enable_if_t<
+                                  !std::is_integral<InputIt>::value>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
   void erase(iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  void resize(size_type n);
+  void resize(size_type n, const_reference value);
+  void assign(size_type n, const_reference value);
+  template <typename InputIt, typename = std::enable_if_t<
+                                  !std::is_integral<InputIt>::value>>
+  void assign(InputIt first, InputIt last);
+  void assign(std::initializer_list<value_type> items);
 
   void push_back(const_reference value) {
     if (size_ == capacity_) {
-      reserve(size_ * 2 + 1);
+      Grow(size_ + 1);
     }
     arr_[size_++] = value;
   }
   void pop_back() { size_--; }
-  void swap(vector &other);
+  void swap(vector &other) noexcept;
 
   // bonus
   template <typename... Args>
@@ -106,11 +161,26 @@ class vector {
 
   template <typename... Args>
   void insert_many_back(Args &&...args);
+
+ private:
+  // Makes room for at least required elements; the new capacity is
+  // chosen by the growth policy, so a series of appends reallocates
+  // only O(log n) times.
+  void Grow(size_type required);
+
+  // Opens a gap of n elements at index i, moving the tail once (or
+  // moving everything once into a new array if the capacity is short),
+  // and returns the first element of the gap.
+  iterator OpenGap(size_type i, size_type n);
+
+  // Commits the mapped storage up to size elements and constructs them
+  void CommitMapped(size_type size);
+  void ReleaseMapped() noexcept;
 };
 
 // definitions
-template <typename T>
-vector<T>::vector(std::initializer_list<value_type> const &items) {
+template <typename T, typename Growth>
+vector<T, Growth>::vector(std::initializer_list<value_type> const &items) {
   arr_ = new value_type[items.size()];
   int i = 0;
   for (auto it = items.begin(); it != items.end(); it++) {
@@ -121,8 +191,8 @@ vector<T>::vector(std::initializer_list<value_type> const &items) {
   capacity_ = items.size();
 }
 
-template <typename T>
-vector<T>::vector(const vector &v) {
+template <typename T, typename Growth>
+vector<T, Growth>::vector(const vector &v) {
   size_ = v.size_;
   capacity_ = v.capacity_;
   arr_ = new value_type[capacity_];
@@ -131,27 +201,48 @@ vector<T>::vector(const vector &v) {
   }
 }
 
-template <typename T>
-vector<T>::vector(vector &&v) noexcept {
+template <typename T, typename Growth>
+vector<T, Growth>::vector(vector &&v) noexcept {
   size_ = v.size_;
   capacity_ = v.capacity_;
   arr_ = v.arr_;
+  mapped_size_ = v.mapped_size_;
   v.arr_ = nullptr;
   v.size_ = 0;
   v.capacity_ = 0;
+  v.mapped_size_ = 0;
 }
 
-template <typename T>
-T &vector<T>::at(size_type pos) const {
+template <typename T, typename Growth>
+vector<T, Growth>::vector(mapped_storage storage) : vector() {
+  if (storage.max_size == 0) return;
+  if (storage.max_size > MAX_SIZE / sizeof(T))
+    throw std::length_error("vector too long");
+  arr_ = static_cast<T *>(
+      MappedMemory::Reserve(storage.max_size * sizeof(T), storage.huge_pages));
+  if (arr_) mapped_size_ = storage.max_size;
+}
+
+template <typename T, typename Growth>
+T &vector<T, Growth>::at(size_type pos) const {
   if (pos >= size_) {
     throw std::out_of_range("out of range");
   }
   return arr_[pos];
 }
 
-template <typename T>
-void vector<T>::reserve(size_t size) {
-  if (size > capacity_) {
+template <typename T, typename Growth>
+void vector<T, Growth>::reserve(size_t size) {
+  reserve_exact(size);
+}
+
+// allocates room for exactly size elements (if there is less),
+// whatever the growth policy: for the callers that know the final size
+template <typename T, typename Growth>
+void vector<T, Growth>::reserve_exact(size_t size) {
+  if (size > capacity_ && is_mapped()) {
+    CommitMapped(size);
+  } else if (size > capacity_) {
     value_type *buff = new value_type[size];
     for (size_t i = 0; i < size_; ++i) buff[i] = std::move(arr_[i]);
     delete[] arr_;
@@ -160,8 +251,9 @@ void vector<T>::reserve(size_t size) {
   }
 }
 
-template <typename T>
-void vector<T>::shrink_to_fit() {
+template <typename T, typename Growth>
+void vector<T, Growth>::shrink_to_fit() {
+  if (is_mapped()) return;
   value_type *buff = new value_type[size_];
   for (size_t i = 0; i < size_; ++i) {
     buff[i] = std::move(arr_[i]);
@@ -171,37 +263,101 @@ void vector<T>::shrink_to_fit() {
   capacity_ = size_;
 }
 
-template <typename T>
-T *vector<T>::insert(iterator pos, const_reference value) {
-  size_t i = 0;
-  for (auto *it = begin(); it < pos; it++) {
-    i++;
-  }
-  if (size_ == capacity_) {
-    reserve(size_ * 2 + 1);
-  }
-  for (size_t k = size_; k != i; k--) {
-    arr_[k] = arr_[k - 1];
-  }
-  arr_[i] = value;
-  size_++;
-  return &arr_[i];
+// The value is copied first, so it may be an element of the vector.
+template <typename T, typename Growth>
+T *vector<T, Growth>::insert(iterator pos, const_reference value) {
+  value_type tmp(value);
+  iterator gap = OpenGap(pos - arr_, 1);
+  *gap = std::move(tmp);
+  return gap;
 }
 
-template <typename T>
-void vector<T>::erase(iterator pos) {
-  size_t i = 0;
-  for (auto *it = begin(); it < pos; it++) {
-    i++;
-  }
-  for (int k = i; k < (int)size_ - 1; k++) {
-    arr_[k] = arr_[k + 1];
+// inserts n copies of value before pos
+template <typename T, typename Growth>
+T *vector<T, Growth>::insert(const_iterator pos, size_type n,
+                             const_reference value) {
+  value_type tmp(value);
+  iterator gap = OpenGap(pos - arr_, n);
+  std::fill_n(gap, n, tmp);
+  return gap;
+}
+
+// inserts [first, last) before pos; the range must not be a part of
+// the vector. A range of input iterators, whose length can't be known
+// in advance, is read into a temporary vector first.
+template <typename T, typename Growth>
+template <typename InputIt, typename>
+T *vector<T, Growth>::insert(const_iterator pos, InputIt first,
+                             InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+    iterator gap = OpenGap(pos - arr_, std::distance(first, last));
+    std::copy(first, last, gap);
+    return gap;
+  } else {
+    vector tmp;
+    for (; first != last; ++first) tmp.push_back(*first);
+    return insert(pos, tmp.begin(), tmp.end());
   }
+}
+
+template <typename T, typename Growth>
+void vector<T, Growth>::erase(iterator pos) {
+  std::move(pos + 1, end(), pos);
   size_--;
 }
 
-template <typename T>
-void vector<T>::swap(vector &other) {
+// erases [first, last) shifting the tail once, returns the element
+// that follows the erased ones
+template <typename T, typename Growth>
+T *vector<T, Growth>::erase(const_iterator first, const_iterator last) {
+  iterator dst = arr_ + (first - arr_);
+  std::move(arr_ + (last - arr_), end(), dst);
+  size_ -= last - first;
+  return dst;
+}
+
+template <typename T, typename Growth>
+void vector<T, Growth>::resize(size_type n) {
+  resize(n, value_type());
+}
+
+template <typename T, typename Growth>
+void vector<T, Growth>::resize(size_type n, const_reference value) {
+  if (n > size_) {
+    value_type tmp(value);
+    Grow(n);
+    std::fill(end(), arr_ + n, tmp);
+  }
+  size_ = n;
+}
+
+template <typename T, typename Growth>
+void vector<T, Growth>::assign(size_type n, const_reference value) {
+  value_type tmp(value);
+  size_ = 0;
+  reserve_exact(n);
+  std::fill_n(arr_, n, tmp);
+  size_ = n;
+}
+
+template <typename T, typename Growth>
+template <typename InputIt, typename>
+void vector<T, Growth>::assign(InputIt first, InputIt last) {
+  size_ = 0;
+  insert(arr_, first, last);
+}
+
+template <typename T, typename Growth>
+void vector<T, Growth>::assign(std::initializer_list<value_type> items) {
+  size_ = 0;
+  reserve_exact(items.size());
+  std::copy(items.begin(), items.end(), arr_);
+  size_ = items.size();
+}
+
+template <typename T, typename Growth>
+void vector<T, Growth>::swap(vector &other) noexcept {
   value_type *buff = other.arr_;
   size_t b_size = other.size();
   size_t b_capacity = other.capacity();
@@ -211,6 +367,7 @@ void vector<T>::swap(vector &other) {
   arr_ = buff;
   size_ = b_size;
   capacity_ = b_capacity;
+  std::swap(mapped_size_, other.mapped_size_);
 }
 
 template <typename T>
@@ -218,41 +375,74 @@ T helper(T value) {
   return value;
 }
 
-template <typename T>
+// The values are made first, so args may be elements of the vector.
+template <typename T, typename Growth>
 template <typename... Args>
-T *vector<T>::insert_many(const_iterator pos, Args &&...args) {
-  vector<T> a = {args...};
-  size_t number = sizeof...(args);
-  int i = 0;
-  for (auto *it = begin(); it < pos; it++) {
-    i++;
-  }
-  if (size_ + number > capacity_) {
-    reserve(size_ + number);
-  }
-  for (size_t k = size_ + number - 1; k != i + number - 1; k--) {
-    arr_[k] = arr_[k - number];
-  }
-  for (size_t j = i; j < i + number; j++) {
-    arr_[j] = a[j - i];
+T *vector<T, Growth>::insert_many(const_iterator pos, Args &&...args) {
+  if constexpr (sizeof...(args) == 0) {
+    return OpenGap(pos - arr_, 0);
+  } else {
+    value_type items[] = {value_type(std::forward<Args>(args))...};
+    iterator gap = OpenGap(pos - arr_, sizeof...(args));
+    std::move(std::begin(items), std::end(items), gap);
+    return gap;
   }
-  size_ += number;
-  return &arr_[i];
 }
 
-template <typename T>
+template <typename T, typename Growth>
 template <typename... Args>
-void vector<T>::insert_many_back(Args &&...args) {
-  vector<T> a = {args...};
-  int number = sizeof...(args);
-  if (size_ + number > capacity_) {
-    reserve(size_ + number);
+void vector<T, Growth>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Growth>
+void vector<T, Growth>::Grow(size_type required) {
+  if (required > capacity_) {
+    size_type capacity = Growth()(capacity_, required);
+    if (is_mapped() && required <= mapped_size_)
+      capacity = std::min(capacity, mapped_size_);
+    reserve_exact(capacity);
+  }
+}
+
+template <typename T, typename Growth>
+T *vector<T, Growth>::OpenGap(size_type i, size_type n) {
+  if (size_ + n > capacity_ && is_mapped()) Grow(size_ + n);
+  if (size_ + n > capacity_) {
+    size_type capacity = Growth()(capacity_, size_ + n);
+    value_type *buff = new value_type[capacity];
+    std::move(arr_, arr_ + i, buff);
+    std::move(arr_ + i, arr_ + size_, buff + i + n);
+    delete[] arr_;
+    arr_ = buff;
+    capacity_ = capacity;
+  } else {
+    std::move_backward(arr_ + i, arr_ + size_, arr_ + size_ + n);
   }
-  for (int i = 0; i < number; i++) {
-    arr_[size_++] = a[i];
+  size_ += n;
+  return arr_ + i;
+}
+
+// Commits whole pages, so only the touched part of the reserved range
+// takes memory. The committed pages are zeroed, which is the value of
+// a trivial T; anything else is constructed.
+template <typename T, typename Growth>
+void vector<T, Growth>::CommitMapped(size_type size) {
+  if (size > mapped_size_) throw std::length_error("mapped vector is full");
+  MappedMemory::Commit(arr_, capacity_ * sizeof(T), size * sizeof(T));
+  if constexpr (std::is_trivially_default_constructible<T>::value) {
+    capacity_ = size;
+  } else {
+    for (; capacity_ < size; ++capacity_) ::new (arr_ + capacity_) T();
   }
 }
 
+template <typename T, typename Growth>
+void vector<T, Growth>::ReleaseMapped() noexcept {
+  std::destroy(arr_, arr_ + capacity_);
+  MappedMemory::Release(arr_, mapped_size_ * sizeof(T));
+}
+
 }  // namespace s21
 
 #endif  // S21_CONTAINERS_VECTOR_VECTOR_H_  // NOLINT